@@ -17,12 +17,18 @@
 #include <string>
 #include <iostream>
 #include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
 
 namespace Clipper2Lib 
 {
 
 //#define REVERSE_ORIENTATION
 //#define USINGZ
+//#define USINGINDEXEDLINKS  //32bit OutPt links (less memory, a little slower)
+//#define USINGSTATS  //ClipperBase execution statistics (see ExecuteStats)
+//#define USINGPROFILER  //profiles engine and offset phases (see Utils/Profiler.h)
 
 	static double const PI = 3.141592653589793238;
 
@@ -375,7 +381,7 @@ inline double DistanceSqr(const Point<T> pt1, const Point<T> pt2) {
 template <typename T>
 inline double Distance(const Point<T> pt1, const Point<T> pt2)
 {
-	return std::sqrt(DistanceSqr(pt1.x - pt2.x) + Sqr(pt1.y - pt2.y));
+	return std::sqrt(DistanceSqr(pt1, pt2));
 }
 
 template <typename T>
@@ -442,7 +448,7 @@ template <typename T>
 static Path<T> Ellipse(const Point<T>& center,
 	double radiusX, double radiusY = 0, int steps = 0)
 {
-	if (radiusX <= 0) return Path64();
+	if (radiusX <= 0) return Path<T>();
 	if (radiusY <= 0) radiusY = radiusX;
 	if (steps <= 2)
 		steps = static_cast<int>(PI * sqrt((radiusX + radiusY) / 2));
@@ -526,6 +532,54 @@ static Paths<T> RamerDouglasPeucker(const Paths<T>& paths, double epsilon)
 	return result;
 }
 
+// Parallel --------------------------------------------------------------------
+
+//ParallelFor: calls func(i) for every i in [0, count) using up to thread_count
+//threads (including the calling thread). Items are handed out one at a time so
+//uneven workloads are balanced. Any exception thrown by func is rethrown (in
+//the calling thread) once all threads have finished.
+template <typename Func>
+void ParallelFor(size_t count, unsigned thread_count, Func func)
+{
+	if (thread_count > count) thread_count = static_cast<unsigned>(count);
+	if (thread_count <= 1)
+	{
+		for (size_t i = 0; i < count; ++i) func(i);
+		return;
+	}
+
+	std::atomic<size_t> next_idx(0);
+	std::exception_ptr error;
+	std::atomic<bool> has_error(false);
+	auto worker = [&]()
+	{
+		try
+		{
+			for (size_t i = next_idx++; i < count && !has_error; i = next_idx++)
+				func(i);
+		}
+		catch (...)
+		{
+			if (!has_error.exchange(true)) error = std::current_exception();
+		}
+	};
+
+	std::vector<std::thread> threads;
+	threads.reserve(thread_count - 1);
+	for (unsigned i = 1; i < thread_count; ++i)
+		threads.emplace_back(worker);
+	worker();
+	for (std::thread& thread : threads) thread.join();
+	if (error) std::rethrow_exception(error);
+}
+
 }  //namespace
 
+#ifdef USINGPROFILER
+#include "../Utils/Profiler.h"
+#define CLIPPER_PROFILE(name) Clipper2Lib::ProfileScope clipper_profile_scope(name)
+#else
+#define CLIPPER_PROFILE(name)
+#endif
+
 #endif  // CLIPPER_CORE_H
@@ -9,6 +9,7 @@
 *******************************************************************************/
 
 #include <stdlib.h>
+#include <chrono>
 #include <cmath>
 #include <stdexcept>
 #include <vector>
@@ -16,8 +17,36 @@
 #include <algorithm>
 #include "clipper.engine.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define CLIPPER_NEON
+#endif
+
 namespace Clipper2Lib {
 
+	//STATS_ADD & STATS_TIMER: update ExecuteStats in USINGSTATS builds, and
+	//compile to nothing otherwise. STATS_TIMER adds the time until the end of
+	//the current scope to the specified field.
+#ifdef USINGSTATS
+	struct StatsTimer {
+		int64_t& ns;
+		const std::chrono::steady_clock::time_point started;
+		explicit StatsTimer(int64_t& ns_) : ns(ns_), started(std::chrono::steady_clock::now()) {}
+		~StatsTimer()
+		{
+			ns += std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now() - started).count();
+		}
+	};
+#define STATS_ADD(field, cnt) stats_.field += (cnt)
+#define STATS_TIMER(field) StatsTimer stats_timer(stats_.field)
+#else
+#define STATS_ADD(field, cnt)
+#define STATS_TIMER(field)
+#endif
+
 	static const double DefaultScale = 100;
 	static const double FloatingPointTolerance = 1.0e-12;
 
@@ -34,15 +63,6 @@ namespace Clipper2Lib {
 		explicit Scanline(int64_t y_) : y(y_) {}
 	};
 
-	struct IntersectNode {
-		Point64 pt;
-		Active* edge1;
-		Active* edge2;
-
-		IntersectNode(Active* e1, Active* e2, Point64& pt_) :
-			pt(pt_), edge1(e1), edge2(e2) {}
-	};
-
 	struct  Joiner {
 		int			idx;
 		OutPt* op1;
@@ -186,6 +206,83 @@ namespace Clipper2Lib {
 	}
 
 
+	//TopXs: x[i] += round(dx[i] * dy[i]) (ie TopX for a packed array of edges
+	//where x contains each edge's bot.x and dy is the height above each bot.y)
+	void TopXs(int64_t* x, const double* dx, const double* dy, size_t cnt)
+	{
+		size_t i = 0;
+#if defined(__AVX2__)
+		//AVX2 has no double to int64 conversion, but for values smaller than 2^51
+		//adding 1.5 * 2^52 leaves the integer in the low bits of the mantissa
+		const __m256d sign_mask = _mm256_set1_pd(-0.0);
+		const __m256d half = _mm256_set1_pd(0.5);
+		const __m256d one = _mm256_set1_pd(1.0);
+		const __m256d limit = _mm256_set1_pd(2251799813685248.0);  //2^51
+		const __m256d magic = _mm256_set1_pd(6755399441055744.0);  //1.5 * 2^52
+		for (; i + 4 <= cnt; i += 4)
+		{
+			__m256d val = _mm256_mul_pd(_mm256_loadu_pd(dx + i), _mm256_loadu_pd(dy + i));
+			//round half away from zero (as per std::round)
+			__m256d trunc = _mm256_round_pd(val, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+			__m256d frac = _mm256_andnot_pd(sign_mask, _mm256_sub_pd(val, trunc));
+			__m256d adj = _mm256_and_pd(_mm256_cmp_pd(frac, half, _CMP_GE_OQ),
+				_mm256_or_pd(one, _mm256_and_pd(sign_mask, val)));
+			__m256d rounded = _mm256_add_pd(trunc, adj);
+			if (_mm256_movemask_pd(_mm256_cmp_pd(
+				_mm256_andnot_pd(sign_mask, rounded), limit, _CMP_NLT_UQ)))
+			{
+				for (size_t j = i; j < i + 4; ++j)
+					x[j] += static_cast<int64_t>(std::round(dx[j] * dy[j]));
+				continue;
+			}
+			__m256i offsets = _mm256_sub_epi64(
+				_mm256_castpd_si256(_mm256_add_pd(rounded, magic)),
+				_mm256_castpd_si256(magic));
+			__m256i* xi = reinterpret_cast<__m256i*>(x + i);
+			_mm256_storeu_si256(xi, _mm256_add_epi64(_mm256_loadu_si256(xi), offsets));
+		}
+#elif defined(CLIPPER_NEON)
+		for (; i + 2 <= cnt; i += 2)
+		{
+			float64x2_t val = vmulq_f64(vld1q_f64(dx + i), vld1q_f64(dy + i));
+			//vcvtaq rounds to nearest with ties away from zero (as per std::round)
+			vst1q_s64(x + i, vaddq_s64(vld1q_s64(x + i), vcvtaq_s64_f64(val)));
+		}
+#endif
+		for (; i < cnt; ++i)
+			x[i] += static_cast<int64_t>(std::round(dx[i] * dy[i]));
+	}
+
+
+	//FindInversion: returns the first i (starting from 'start') where x[i + 1]
+	//is less than x[i], otherwise cnt.
+	size_t FindInversion(const int64_t* x, size_t start, size_t cnt)
+	{
+		size_t i = start;
+#if defined(__AVX2__)
+		for (; i + 4 < cnt; i += 4)
+		{
+			__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i));
+			__m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i + 1));
+			int mask = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(a, b)));
+			if (!mask) continue;
+			while (!(mask & 1)) { mask >>= 1; ++i; }
+			return i;
+		}
+#elif defined(CLIPPER_NEON)
+		for (; i + 2 < cnt; i += 2)
+		{
+			uint64x2_t gt = vcgtq_s64(vld1q_s64(x + i), vld1q_s64(x + i + 1));
+			if (vgetq_lane_u64(gt, 0)) return i;
+			if (vgetq_lane_u64(gt, 1)) return i + 1;
+		}
+#endif
+		for (; i + 1 < cnt; ++i)
+			if (x[i + 1] < x[i]) return i;
+		return cnt;
+	}
+
+
 	inline bool IsHorizontal(const Active& e)
 	{
 		return (e.top.y == e.bot.y);
@@ -315,9 +412,9 @@ namespace Clipper2Lib {
 #else 
 		if (e.wind_dx < 0)
 #endif 
-			return e.vertex_top->next;
+			return e.vertex_top->Next();
 		else
-			return e.vertex_top->prev;
+			return e.vertex_top->Prev();
 	}
 
 
@@ -328,9 +425,9 @@ namespace Clipper2Lib {
 #else 
 		if (ae.wind_dx < 0)
 #endif 
-			return ae.vertex_top->prev->prev;
+			return ae.vertex_top->Prev()->Prev();
 		else
-			return ae.vertex_top->next->next;
+			return ae.vertex_top->Next()->Next();
 	}
 
 
@@ -372,18 +469,21 @@ namespace Clipper2Lib {
 #else 
 		if (e.wind_dx < 0)
 #endif 
-			while (result->next->pt.y == result->pt.y) result = result->next;
+			while (result->Next()->pt.y == result->pt.y) result = result->Next();
 		else
-			while (result->prev->pt.y == result->pt.y) result = result->prev;
+			while (result->Prev()->pt.y == result->pt.y) result = result->Prev();
 		if (!IsMaxima(*result)) result = nullptr; //not a maxima   
 		return result;
 	}
 
 	Active* GetMaximaPair(const Active& e)
 	{
+		//nb: this is only called from DoTopOfScanbeam (via DoMaxima) where every
+		//edge's curr_x is already at e.top.y, so the pair (which also ends at
+		//e.top) can't be beyond any edge that's to the right of e.top.x
 		Active* e2;
 		e2 = e.next_in_ael;
-		while (e2)
+		while (e2 && e2->curr_x <= e.top.x)
 		{
 			if (e2->vertex_top == e.vertex_top) return e2;  //Found!
 			e2 = e2->next_in_ael;
@@ -422,9 +522,9 @@ namespace Clipper2Lib {
 	}
 
 
-	inline OutPt* InsertOp(const Point64& pt, OutPt* insertAfter)
+	inline OutPt* InsertOp(const Point64& pt, OutPt* insertAfter, Arena& arena)
 	{
-		OutPt* result = new OutPt(pt, insertAfter->outrec);
+		OutPt* result = arena.New<OutPt>(pt, insertAfter->outrec);
 		result->next = insertAfter->next;
 		insertAfter->next->prev = result;
 		insertAfter->next = result;
@@ -438,30 +538,94 @@ namespace Clipper2Lib {
 		OutPt* result = op->next;
 		op->prev->next = op->next;
 		op->next->prev = op->prev;
-		delete op;
 		return result;
 	}
 
 
-	inline void DisposeOutPts(OutRec& outrec)
+	inline bool IntersectListSort(const IntersectNode& a, const IntersectNode& b)
 	{
-		if (!outrec.pts) return;
-		OutPt* op2 = outrec.pts->next;
-		while (op2 != outrec.pts)
-		{
-			OutPt* tmp = op2->next;
-			delete op2;
-			op2 = tmp;
-		}
-		delete outrec.pts;
-		outrec.pts = nullptr;
+		//note different inequality tests ...
+		return (a.pt.y == b.pt.y) ? (a.pt.x < b.pt.x) : (a.pt.y > b.pt.y);
 	}
 
 
-	bool IntersectListSort(IntersectNode* a, IntersectNode* b)
+	inline int BitsNeeded(uint64_t val)
 	{
-		//note different inequality tests ...
-		return (a->pt.y == b->pt.y) ? (a->pt.x < b->pt.x) : (a->pt.y > b->pt.y);
+		int result = 0;
+		while (val) { ++result; val >>= 1; }
+		return result;
+	}
+
+
+	void SortIntersectNodes(std::vector<IntersectNode>& nodes,
+		std::vector<IntersectNode>& buffer)
+	{
+		//Sorts intersections bottom-up (descending Y) then left to right (ascending
+		//X), ie the same order as IntersectListSort. Short lists are simply sorted
+		//with std::sort, otherwise each node's Y and X offsets (relative to the
+		//nodes' bounds) are packed into a single 64bit key that's then used in a
+		//(byte-wise) LSD radix sort. Since Y values are confined to the current
+		//scanbeam, the keys are usually short and only a few passes are needed.
+		const size_t cnt = nodes.size();
+		if (cnt < 64)
+		{
+			std::sort(nodes.begin(), nodes.end(), IntersectListSort);
+			return;
+		}
+
+		int64_t min_x = nodes[0].pt.x, max_x = min_x;
+		int64_t min_y = nodes[0].pt.y, max_y = min_y;
+		for (const IntersectNode& node : nodes)
+		{
+			if (node.pt.x < min_x) min_x = node.pt.x;
+			else if (node.pt.x > max_x) max_x = node.pt.x;
+			if (node.pt.y < min_y) min_y = node.pt.y;
+			else if (node.pt.y > max_y) max_y = node.pt.y;
+		}
+		const int bits_x = BitsNeeded(static_cast<uint64_t>(max_x) - static_cast<uint64_t>(min_x));
+		const int bits_y = BitsNeeded(static_cast<uint64_t>(max_y) - static_cast<uint64_t>(min_y));
+		if (bits_x + bits_y > 64)
+		{
+			std::sort(nodes.begin(), nodes.end(), IntersectListSort);
+			return;
+		}
+
+		auto get_key = [=](const IntersectNode& node) -> uint64_t
+		{
+			uint64_t key_y = static_cast<uint64_t>(max_y) - static_cast<uint64_t>(node.pt.y);
+			uint64_t key_x = static_cast<uint64_t>(node.pt.x) - static_cast<uint64_t>(min_x);
+			return (bits_x < 64 ? key_y << bits_x : 0) | key_x;
+		};
+
+		const int passes = (bits_x + bits_y + 7) / 8;
+		size_t counts[8][256] = {};
+		for (const IntersectNode& node : nodes)
+		{
+			uint64_t key = get_key(node);
+			for (int i = 0; i < passes; ++i)
+				++counts[i][(key >> (i * 8)) & 0xFF];
+		}
+
+		buffer.resize(cnt);
+		IntersectNode* src = nodes.data(), * dst = buffer.data();
+		for (int i = 0; i < passes; ++i)
+		{
+			size_t* pass_counts = counts[i];
+			const int shift = i * 8;
+			if (pass_counts[(get_key(src[0]) >> shift) & 0xFF] == cnt)
+				continue; //every key has the same digit so skip this pass
+
+			size_t offsets[256], offset = 0;
+			for (int j = 0; j < 256; ++j)
+			{
+				offsets[j] = offset;
+				offset += pass_counts[j];
+			}
+			for (size_t j = 0; j < cnt; ++j)
+				dst[offsets[(get_key(src[j]) >> shift) & 0xFF]++] = src[j];
+			std::swap(src, dst);
+		}
+		if (src != nodes.data()) nodes.swap(buffer);
 	}
 
 
@@ -550,7 +714,7 @@ namespace Clipper2Lib {
 	}
 
 
-	inline void UncoupleOutRec(Active ae)
+	inline void UncoupleOutRec(const Active& ae)
 	{
 		OutRec* outrec = ae.outrec;
 		if (!outrec) return;
@@ -561,6 +725,18 @@ namespace Clipper2Lib {
 	}
 
 
+	inline void TerminateOpenPath(Active& ae)
+	{
+		//detach just this end of an open path (its other end may still be active)
+		OutRec* outrec = ae.outrec;
+		if (outrec->front_edge == &ae)
+			outrec->front_edge = nullptr;
+		else if (outrec->back_edge == &ae)
+			outrec->back_edge = nullptr;
+		ae.outrec = nullptr;
+	}
+
+
 	inline bool IsValidClosedPath(const OutPt* op)
 	{
 		return (op && op->next != op && op->next != op->prev);
@@ -662,144 +838,204 @@ namespace Clipper2Lib {
 
 
 	//------------------------------------------------------------------------------
-	// ClipperBase methods ...
+	// Arena methods ...
 	//------------------------------------------------------------------------------
 
-	ClipperBase::~ClipperBase()
-	{
-		Clear();
-	}
+	static const size_t ArenaMinBlockSize = 4096;
+	static const size_t ArenaMaxBlockSize = 1 << 20;
 
-
-	void ClipperBase::CleanUp()
+	void Arena::AddBlock(size_t size)
 	{
-		while (actives_) DeleteFromAEL(*actives_);
-		scanline_list_ = std::priority_queue<int64_t>();
-		DisposeIntersectNodes();
-		DisposeAllOutRecs();
+		if (!linkable_)
+		{
+			char* data = static_cast<char*>(::operator new(size));
+			blocks_.push_back(Block{ data, size, data });
+		}
+		else
+		{
+			//each block must be aligned to its size
+			if (blocks_.size() >> (32 - (ArenaLinkBlockBits - 3)))
+				throw std::length_error("Clipper2: Arena exceeded its maximum size");
+#ifdef __cpp_aligned_new
+			void* memory = ::operator new(ArenaLinkBlockSize,
+				std::align_val_t(ArenaLinkBlockSize));
+			uintptr_t addr = reinterpret_cast<uintptr_t>(memory);
+#else
+			//without C++17's aligned new, over-allocate so the block can be aligned
+			void* memory = ::operator new(ArenaLinkBlockSize * 2);
+			uintptr_t addr = (reinterpret_cast<uintptr_t>(memory) + ArenaLinkBlockSize - 1) &
+				~static_cast<uintptr_t>(ArenaLinkBlockSize - 1);
+#endif
+			LinkBlockHeader* header = reinterpret_cast<LinkBlockHeader*>(addr);
+			header->arena = this;
+			header->block_no = static_cast<uint32_t>(blocks_.size());
+			blocks_.push_back(Block{ reinterpret_cast<char*>(addr), ArenaLinkBlockSize, memory });
+		}
+		stats_.bytes_reserved += BlockMemorySize(blocks_.back());
 	}
 
 
-	void ClipperBase::Clear()
+	void Arena::FreeBlock(const Block& block) const
 	{
-		CleanUp();
-		DisposeVerticesAndLocalMinima();
-		loc_min_iter_ = minima_list_.begin();
-		minima_list_sorted_ = false;
-		has_open_paths_ = false;
+#ifdef __cpp_aligned_new
+		if (linkable_)
+		{
+			::operator delete(block.memory, std::align_val_t(ArenaLinkBlockSize));
+			return;
+		}
+#endif
+		::operator delete(block.memory);
 	}
 
 
-	void ClipperBase::Reset()
+	void* Arena::AllocateSlow(size_t size, size_t align)
 	{
-		if (!minima_list_sorted_)
+		//first try blocks that have been reserved already (see Rewind), otherwise
+		//each new block is double the size of the previous one (within limits)
+		//unless a larger block is needed to accommodate the requested size
+		size_t idx = curr_ ? block_idx_ + 1 : 0;
+		if (idx == blocks_.size())
 		{
-			std::sort(minima_list_.begin(), minima_list_.end(), LocMinSorter());
-			minima_list_sorted_ = true;
+			if (linkable_)
+			{
+				if (size + align + sizeof(LinkBlockHeader) > ArenaLinkBlockSize)
+					throw std::length_error("Clipper2: Arena allocation too large");
+				AddBlock(ArenaLinkBlockSize);
+			}
+			else
+			{
+				size_t block_size = blocks_.empty() ? ArenaMinBlockSize :
+					std::min(blocks_.back().size * 2, ArenaMaxBlockSize);
+				if (block_size < size + align) block_size = size + align;
+				AddBlock(block_size);
+			}
 		}
-		std::vector<LocalMinima*>::const_reverse_iterator i;
-		for (i = minima_list_.rbegin(); i != minima_list_.rend(); ++i)
-			InsertScanline((*i)->vertex->pt.y);
+		block_idx_ = idx;
+		curr_ = reinterpret_cast<uintptr_t>(blocks_[idx].data);
+		if (linkable_) curr_ += sizeof(LinkBlockHeader);
+		end_ = reinterpret_cast<uintptr_t>(blocks_[idx].data) + blocks_[idx].size;
+		return Allocate(size, align);
+	}
 
-		loc_min_iter_ = minima_list_.begin();
-		actives_ = nullptr;
-		sel_ = nullptr;
-		error_found_ = false;
+
+	void Arena::Release()
+	{
+		for (const Block& block : blocks_) FreeBlock(block);
+		blocks_.clear();
+		block_idx_ = 0;
+		curr_ = 0;
+		end_ = 0;
+		stats_ = ArenaStats();
 	}
 
 
-#ifdef USINGZ
-	void ClipperBase::SetZ(const Active& e1, const Active& e2, Point64& ip)
+	void Arena::Rewind()
 	{
-		if (!zfill_func_) return;
-		//prioritize subject vertices over clip vertices
-		//and pass the subject vertices before clip vertices in the callback
-		if (GetPolyType(e1) == PathType::Subject)
+		if (blocks_.empty()) return;
+		//consolidate multiple blocks into one so that subsequent similar
+		//use of the arena won't require any further memory allocation
+		//(except in linkable arenas where all blocks are simply reused)
+		if (blocks_.size() > 1 && !linkable_)
 		{
-			if (ip == e1.bot) ip.z = e1.bot.z;
-			else if (ip == e1.top) ip.z = e1.top.z;
-			else if (ip == e2.bot) ip.z = e2.bot.z;
-			else if (ip == e2.top) ip.z = e2.top.z;
-			zfill_func_(e1.bot, e1.top, e2.bot, e2.top, ip);
-		}
-		else
-		{
-			if (ip == e2.bot) ip.z = e2.bot.z;
-			else if (ip == e2.top) ip.z = e2.top.z;
-			else if (ip == e1.bot) ip.z = e1.bot.z;
-			else if (ip == e1.top) ip.z = e1.top.z;
-			zfill_func_(e2.bot, e2.top, e1.bot, e1.top, ip);
+			size_t total_size = stats_.bytes_reserved;
+			Release();
+			AddBlock(total_size);
 		}
+		stats_.bytes_used = 0;
+		stats_.allocations = 0;
+		block_idx_ = 0;
+		curr_ = reinterpret_cast<uintptr_t>(blocks_[0].data);
+		if (linkable_) curr_ += sizeof(LinkBlockHeader);
+		end_ = reinterpret_cast<uintptr_t>(blocks_[0].data) + blocks_[0].size;
 	}
 
-#endif
+	//------------------------------------------------------------------------------
+	// Path preparation (vertices and local minima) ...
+	//------------------------------------------------------------------------------
 
-	void ClipperBase::AddPath(const Path64& path, PathType polytype, bool is_open)
+	static void AddLocMin(Vertex& vert, size_t path_idx, PathType polytype,
+		bool is_open, Arena& arena, std::vector<LocalMinima*>& minima_list)
 	{
-		Paths64 tmp;
-		tmp.push_back(path);
-		AddPaths(tmp, polytype, is_open);
+		//make sure the vertex is added only once ...
+		if ((VertexFlags::LocalMin & vert.flags) != VertexFlags::None) return;
+
+		vert.flags = (vert.flags | VertexFlags::LocalMin);
+		minima_list.push_back(arena.New<LocalMinima>(&vert, path_idx, polytype, is_open));
 	}
 
 
-	void ClipperBase::AddPaths(const Paths64& paths, PathType polytype, bool is_open)
+	//AddPathsToArena: converts paths into (circular doubly linked lists of)
+	//vertices, recording each path in input_paths and its local minima in
+	//minima_list (see ClipperBase::AddPaths and PreparedPaths64)
+	static void AddPathsToArena(const Paths64& paths, PathType polytype,
+		bool is_open, Arena& arena, std::vector<InputPath>& input_paths,
+		std::vector<LocalMinima*>& minima_list)
 	{
-		if (is_open) has_open_paths_ = true;
-		minima_list_sorted_ = false;
-
 		Path64::size_type total_vertex_count = 0;
 		for (const Path64& path : paths) total_vertex_count += path.size();
 		if (total_vertex_count == 0) return;
-		Vertex* vertices = new Vertex[total_vertex_count], *v = vertices;
+		Vertex* vertices = arena.NewArray<Vertex>(total_vertex_count), *v = vertices;
 		for (const Path64& path : paths)
 		{
 			//for each path create a circular double linked list of vertices
 			Vertex *v0 = v, *curr_v = v, *prev_v = nullptr;
 
-			v->prev = nullptr;
+			v->SetPrev(nullptr);
 			int cnt = 0;
 			for (const Point64 pt : path)
 			{
 				if (prev_v)
 				{
 					if (prev_v->pt == pt) continue; //ie skips duplicates
-					prev_v->next = curr_v;
+					prev_v->SetNext(curr_v);
 				}
-				curr_v->prev = prev_v;
+				curr_v->SetPrev(prev_v);
 				curr_v->pt = pt;
 				curr_v->flags = VertexFlags::None;
 				prev_v = curr_v++;
 				cnt++;
 			}
-			if (!prev_v || !prev_v->prev) continue;
+			if (!prev_v || !prev_v->Prev()) continue;
 			if (!is_open && prev_v->pt == v0->pt)
-				prev_v = prev_v->prev;
-			prev_v->next = v0;
-			v0->prev = prev_v;
+				prev_v = prev_v->Prev();
+			prev_v->SetNext(v0);
+			v0->SetPrev(prev_v);
 			v = curr_v; //ie get ready for next path
 			if (cnt < 2 || (cnt == 2 && !is_open)) continue;
 
+			Rect64 bounds(v0->pt.x, v0->pt.y, v0->pt.x, v0->pt.y);
+			for (Vertex* vb = v0 + 1; vb != curr_v; ++vb)
+			{
+				if (vb->pt.x < bounds.left) bounds.left = vb->pt.x;
+				else if (vb->pt.x > bounds.right) bounds.right = vb->pt.x;
+				if (vb->pt.y < bounds.top) bounds.top = vb->pt.y;
+				else if (vb->pt.y > bounds.bottom) bounds.bottom = vb->pt.y;
+			}
+			input_paths.push_back(InputPath{ v0, static_cast<size_t>(cnt),
+				bounds, polytype, is_open, false });
+			const size_t path_idx = input_paths.size() - 1;
+
 			//now find and assign local minima
 			bool going_up, going_up0;
 			if (is_open)
 			{
-				curr_v = v0->next;
+				curr_v = v0->Next();
 				while (curr_v != v0 && curr_v->pt.y == v0->pt.y)
-					curr_v = curr_v->next;
+					curr_v = curr_v->Next();
 				going_up = curr_v->pt.y <= v0->pt.y;
 				if (going_up)
 				{
 					v0->flags = VertexFlags::OpenStart;
-					AddLocMin(*v0, polytype, true);
+					AddLocMin(*v0, path_idx, polytype, true, arena, minima_list);
 				}
 				else
 					v0->flags = VertexFlags::OpenStart | VertexFlags::LocalMax;
 			}
 			else //closed path
 			{
-				prev_v = v0->prev;
+				prev_v = v0->Prev();
 				while (prev_v != v0 && prev_v->pt.y == v0->pt.y)
-					prev_v = prev_v->prev;
+					prev_v = prev_v->Prev();
 				if (prev_v == v0)
 					continue; //only open paths can be completely flat
 				going_up = prev_v->pt.y > v0->pt.y;
@@ -807,7 +1043,7 @@ namespace Clipper2Lib {
 
 			going_up0 = going_up;
 			prev_v = v0;
-			curr_v = v0->next;
+			curr_v = v0->Next();
 			while (curr_v != v0)
 			{
 				if (curr_v->pt.y > prev_v->pt.y && going_up)
@@ -818,10 +1054,10 @@ namespace Clipper2Lib {
 				else if (curr_v->pt.y < prev_v->pt.y && !going_up)
 				{
 					going_up = true;
-					AddLocMin(*prev_v, polytype, is_open);
+					AddLocMin(*prev_v, path_idx, polytype, is_open, arena, minima_list);
 				}
 				prev_v = curr_v;
-				curr_v = curr_v->next;
+				curr_v = curr_v->Next();
 			}
 
 			if (is_open)
@@ -830,73 +1066,278 @@ namespace Clipper2Lib {
 				if (going_up)
 					prev_v->flags = prev_v->flags | VertexFlags::LocalMax;
 				else
-					AddLocMin(*prev_v, polytype, is_open);
+					AddLocMin(*prev_v, path_idx, polytype, is_open, arena, minima_list);
 			}
 			else if (going_up != going_up0)
 			{
-				if (going_up0) AddLocMin(*prev_v, polytype, false);
+				if (going_up0) AddLocMin(*prev_v, path_idx, polytype, false, arena, minima_list);
 				else prev_v->flags = prev_v->flags | VertexFlags::LocalMax;
 			}
 		} //end processing current path
+	} //end AddPathsToArena
+
+
+	//------------------------------------------------------------------------------
+	// PreparedPaths64 methods ...
+	//------------------------------------------------------------------------------
+
+	PreparedPaths64::PreparedPaths64(const Paths64& paths,
+		PathType polytype, bool is_open) : is_open_(is_open)
+	{
+		AddPathsToArena(paths, polytype, is_open, arena_, input_paths_, minima_list_);
+		std::sort(minima_list_.begin(), minima_list_.end(), LocMinSorter());
+	}
+
+	//------------------------------------------------------------------------------
+	// ClipperBase methods ...
+	//------------------------------------------------------------------------------
+
+	ClipperBase::~ClipperBase()
+	{
+		Clear();
+	}
+
+
+	void ClipperBase::CleanUp()
+	{
+		//nb: all Active, OutRec, OutPt, Joiner and IntersectNode structures
+		//are owned by exec_arena_ so they're released here all at once.
+		actives_ = nullptr;
+		sel_ = nullptr;
+		horz_joiners_ = nullptr;
+		scanline_list_.clear();
+		minima_scanlines_.clear();
+		ael_edges_.clear();
+		ael_x_.clear();
+		DisposeIntersectNodes();
+		joiner_list_.resize(0);
+		DisposeAllOutRecs();
+		//nb: abandoned operations (see Cancellation) may have been pathological
+		//so their memory is released rather than kept for reuse, as is memory
+		//that exceeds ReuseMemoryLimit
+		const bool is_abandoned =
+			status_ == ExecuteStatus::Cancelled || status_ == ExecuteStatus::TimedOut;
+		if (is_abandoned || !IsRetainable(sizeof(IntersectNode) *
+			(intersect_nodes_.capacity() + intersect_nodes_buffer_.capacity())))
+		{
+			std::vector<IntersectNode>().swap(intersect_nodes_);
+			std::vector<IntersectNode>().swap(intersect_nodes_buffer_);
+		}
+		if (!is_abandoned && ReuseMemory &&
+			IsRetainable(exec_arena_.Stats().bytes_reserved))
+			exec_arena_.Rewind();
+		else
+			exec_arena_.Release();
+	}
 
-		vertex_lists_.emplace_back(vertices);
-	} //end AddPaths
+
+	bool ClipperBase::IsRetainable(size_t bytes) const
+	{
+		return !ReuseMemoryLimit || bytes <= ReuseMemoryLimit;
+	}
+
+
+	void ClipperBase::Clear()
+	{
+		CleanUp();
+		DisposeVerticesAndLocalMinima();
+		prepared_paths_.reset();
+		loc_min_iter_ = minima_list_.begin();
+		minima_list_sorted_ = false;
+		has_open_paths_ = false;
+	}
+
+
+	void ClipperBase::Reset()
+	{
+		if (!minima_list_sorted_)
+		{
+			std::sort(minima_list_.begin(), minima_list_.end(), LocMinSorter());
+			minima_list_sorted_ = true;
+		}
+		//since minima_list_ is sorted (descending Y), the minima scanlines can
+		//be extracted in order, and deduplicated, in a single linear pass
+		//(merged with the local minima of prepared paths, also sorted)
+		minima_scanlines_.clear();
+		auto add_scanline = [this](const LocalMinima* lm)
+		{
+			if (has_culled_paths_ && input_paths_[lm->path_idx].is_culled) return;
+			if (minima_scanlines_.empty() || minima_scanlines_.back() != lm->vertex->pt.y)
+				minima_scanlines_.push_back(lm->vertex->pt.y);
+		};
+		std::vector<LocalMinima*>::const_iterator prepared_end = minima_list_.cend();
+		prepared_min_iter_ = prepared_end;
+		if (prepared_paths_)
+		{
+			prepared_min_iter_ = prepared_paths_->minima_list_.cbegin();
+			prepared_end = prepared_paths_->minima_list_.cend();
+		}
+		std::vector<LocalMinima*>::const_iterator prepared_iter = prepared_min_iter_;
+		for (const LocalMinima* lm : minima_list_)
+		{
+			while (prepared_iter != prepared_end &&
+				(*prepared_iter)->vertex->pt.y > lm->vertex->pt.y)
+					add_scanline(*prepared_iter++);
+			add_scanline(lm);
+		}
+		while (prepared_iter != prepared_end) add_scanline(*prepared_iter++);
+		minima_scanline_idx_ = 0;
+
+		loc_min_iter_ = minima_list_.begin();
+		actives_ = nullptr;
+		sel_ = nullptr;
+		error_found_ = false;
+	}
+
+
+#ifdef USINGZ
+	void ClipperBase::ZFillFunction(ZFillCallback zFillFunc)
+	{
+		zfill_func_ = zFillFunc;
+	}
+
+
+	void ClipperBase::SetZ(const Active& e1, const Active& e2, Point64& ip)
+	{
+		if (!zfill_func_) return;
+		//prioritize subject vertices over clip vertices
+		//and pass the subject vertices before clip vertices in the callback
+		if (GetPolyType(e1) == PathType::Subject)
+		{
+			if (ip == e1.bot) ip.z = e1.bot.z;
+			else if (ip == e1.top) ip.z = e1.top.z;
+			else if (ip == e2.bot) ip.z = e2.bot.z;
+			else if (ip == e2.top) ip.z = e2.top.z;
+			zfill_func_(e1.bot, e1.top, e2.bot, e2.top, ip);
+		}
+		else
+		{
+			if (ip == e2.bot) ip.z = e2.bot.z;
+			else if (ip == e2.top) ip.z = e2.top.z;
+			else if (ip == e1.bot) ip.z = e1.bot.z;
+			else if (ip == e1.top) ip.z = e1.top.z;
+			zfill_func_(e2.bot, e2.top, e1.bot, e1.top, ip);
+		}
+	}
+
+#endif
+
+	void ClipperBase::AddPath(const Path64& path, PathType polytype, bool is_open)
+	{
+		Paths64 tmp;
+		tmp.push_back(path);
+		AddPaths(tmp, polytype, is_open);
+	}
+
+
+	void ClipperBase::AddPaths(const Paths64& paths, PathType polytype, bool is_open)
+	{
+		if (is_open) has_open_paths_ = true;
+		minima_list_sorted_ = false;
+		AddPathsToArena(paths, polytype, is_open,
+			path_arena_, input_paths_, minima_list_);
+	}
+
+
+	void ClipperBase::AddPreparedPaths(
+		const std::shared_ptr<const PreparedPaths64>& paths)
+	{
+		if (!paths) return;
+		if (prepared_paths_)
+			throw std::logic_error("Clipper2: only one PreparedPaths64 can be added");
+		prepared_paths_ = paths;
+		if (paths->is_open_) has_open_paths_ = true;
+		//the prepared paths' local minima index the first input paths, so any
+		//paths already added must be reindexed (nb: vertices aren't copied)
+		const size_t path_cnt = paths->input_paths_.size();
+		for (LocalMinima* lm : minima_list_) lm->path_idx += path_cnt;
+		input_paths_.insert(input_paths_.begin(),
+			paths->input_paths_.begin(), paths->input_paths_.end());
+	}
 
 
 	inline void ClipperBase::InsertScanline(int64_t y)
 	{
-		scanline_list_.push(y);
+		scanline_list_.push_back(y);
+		std::push_heap(scanline_list_.begin(), scanline_list_.end());
 	}
 
 
 	bool ClipperBase::PopScanline(int64_t& y)
 	{
-		if (scanline_list_.empty()) return false;
-		y = scanline_list_.top();
-		scanline_list_.pop();
-		while (!scanline_list_.empty() && y == scanline_list_.top())
-			scanline_list_.pop();  // Pop duplicates.
+		//pop the largest Y from either minima_scanlines_ or scanline_list_
+		bool has_minima = minima_scanline_idx_ < minima_scanlines_.size();
+		if (scanline_list_.empty())
+		{
+			if (!has_minima) return false;
+			y = minima_scanlines_[minima_scanline_idx_++];
+			return true;
+		}
+		y = scanline_list_.front();
+		if (has_minima && minima_scanlines_[minima_scanline_idx_] >= y)
+			y = minima_scanlines_[minima_scanline_idx_++];
+		while (!scanline_list_.empty() && y == scanline_list_.front())
+		{
+			std::pop_heap(scanline_list_.begin(), scanline_list_.end());
+			scanline_list_.pop_back();  // Pop duplicates.
+		}
 		return true;
 	}
 
 
 	bool ClipperBase::PopLocalMinima(int64_t y, LocalMinima*& local_minima)
 	{
-		if (loc_min_iter_ == minima_list_.end() || (*loc_min_iter_)->vertex->pt.y != y) return false;
-		local_minima = (*loc_min_iter_++);
+		if (has_culled_paths_)
+			while (loc_min_iter_ != minima_list_.end() &&
+				input_paths_[(*loc_min_iter_)->path_idx].is_culled) ++loc_min_iter_;
+		bool has_local_min = loc_min_iter_ != minima_list_.end() &&
+			(*loc_min_iter_)->vertex->pt.y == y;
+		if (!prepared_paths_)
+		{
+			if (!has_local_min) return false;
+			local_minima = (*loc_min_iter_++);
+			return true;
+		}
+
+		//otherwise merge with the prepared paths' local minima
+		const std::vector<LocalMinima*>::const_iterator prepared_end =
+			prepared_paths_->minima_list_.cend();
+		if (has_culled_paths_)
+			while (prepared_min_iter_ != prepared_end &&
+				input_paths_[(*prepared_min_iter_)->path_idx].is_culled) ++prepared_min_iter_;
+		if (prepared_min_iter_ == prepared_end || (*prepared_min_iter_)->vertex->pt.y != y)
+		{
+			if (!has_local_min) return false;
+			local_minima = (*loc_min_iter_++);
+		}
+		else if (has_local_min && LocMinSorter()(*loc_min_iter_, *prepared_min_iter_))
+			local_minima = (*loc_min_iter_++);
+		else
+			local_minima = (*prepared_min_iter_++);
 		return true;
 	}
 
 
 	void ClipperBase::DisposeAllOutRecs()
 	{
-		for (auto outrec : outrec_list_)
-		{
-			if (outrec->pts) DisposeOutPts(*outrec);
-			delete outrec;
-		}
+		//OutRecs (and their OutPts) are stored in exec_arena_, but OutRec
+		//isn't trivially destructible (see OutRec.splits)
+		for (auto outrec : outrec_list_) outrec->~OutRec();
 		outrec_list_.resize(0);
 	}
 
 
 	void ClipperBase::DisposeVerticesAndLocalMinima()
 	{
-		for (auto lm : minima_list_) delete lm;
 		minima_list_.clear();
-		for (auto v : vertex_lists_) delete[] v;
-		vertex_lists_.clear();
+		input_paths_.clear();
+		if (ReuseMemory && IsRetainable(path_arena_.Stats().bytes_reserved))
+			path_arena_.Rewind();
+		else
+			path_arena_.Release();
 	}
 
 
-	void ClipperBase::AddLocMin(Vertex& vert, PathType polytype, bool is_open)
-	{
-		//make sure the vertex is added only once ...
-		if ((VertexFlags::LocalMin & vert.flags) != VertexFlags::None) return;
-
-		vert.flags = (vert.flags | VertexFlags::LocalMin);
-		minima_list_.push_back(new LocalMinima(&vert, polytype, is_open));
-	}
-
 	bool ClipperBase::IsContributingClosed(const Active & e) const
 	{
 		switch (fillrule_)
@@ -1144,7 +1585,7 @@ namespace Clipper2Lib {
 		}
 		else
 		{
-			e2 = actives_;
+			e2 = GetAelInsertStart(e);
 			while (e2->next_in_ael && IsValidAelOrder(*e2->next_in_ael, e))
 				e2 = e2->next_in_ael;
 			e.next_in_ael = e2->next_in_ael;
@@ -1155,6 +1596,30 @@ namespace Clipper2Lib {
 	}
 
 
+	Active* ClipperBase::GetAelInsertStart(const Active& e) const
+	{
+		//When local minima are inserted, the AEL is ordered by curr_x so the walk
+		//to e's position can start from any edge that's left of e (ie any edge
+		//with a smaller curr_x). ael_edges_ is a snapshot of the AEL at the top of
+		//the previous scanbeam, and it's ordered by curr_x too (see
+		//BuildIntersectList), so a binary search will usually find an edge that's
+		//adjacent or very close to e's position. However, edges in the snapshot
+		//may have since been removed from the AEL, and edges may have moved
+		//while processing horizontals, so candidates must be checked.
+		const size_t max_candidates = 4;
+		if (ael_x_.size() < 2 * max_candidates) return actives_;
+		size_t idx = std::lower_bound(ael_x_.begin(), ael_x_.end(), e.curr_x) -
+			ael_x_.begin();
+		for (size_t i = 0; i < max_candidates && idx > 0; ++i)
+		{
+			Active* e2 = ael_edges_[--idx];
+			if (e2->curr_x < e.curr_x && (e2->prev_in_ael ?
+				e2->prev_in_ael->next_in_ael == e2 : e2 == actives_)) return e2;
+		}
+		return actives_;
+	}
+
+
 	void InsertRightEdge(Active& e, Active& e2)
 	{
 		e2.next_in_ael = e.next_in_ael;
@@ -1173,13 +1638,14 @@ namespace Clipper2Lib {
 
 		while (PopLocalMinima(bot_y, local_minima))
 		{
+			STATS_ADD(local_minima, 1);
 			if ((local_minima->vertex->flags & VertexFlags::OpenStart) != VertexFlags::None)
 			{
 				left_bound = nullptr;
 			}
 			else
 			{
-				left_bound = new Active();
+				left_bound = exec_arena_.New<Active>();
 				left_bound->bot = local_minima->vertex->pt;
 				left_bound->curr_x = left_bound->bot.x;
 #ifdef REVERSE_ORIENTATION
@@ -1187,7 +1653,7 @@ namespace Clipper2Lib {
 #else
 				left_bound->wind_dx = 1,
 #endif
-					left_bound->vertex_top = local_minima->vertex->prev;  //ie descending
+					left_bound->vertex_top = local_minima->vertex->Prev();  //ie descending
 				left_bound->top = left_bound->vertex_top->pt;
 				left_bound->outrec = nullptr;
 				left_bound->local_min = local_minima;
@@ -1200,7 +1666,7 @@ namespace Clipper2Lib {
 			}
 			else
 			{
-				right_bound = new Active();
+				right_bound = exec_arena_.New<Active>();
 				right_bound->bot = local_minima->vertex->pt;
 				right_bound->curr_x = right_bound->bot.x;
 #ifdef REVERSE_ORIENTATION
@@ -1208,7 +1674,7 @@ namespace Clipper2Lib {
 #else
 				right_bound->wind_dx = -1,
 #endif
-					right_bound->vertex_top = local_minima->vertex->next;  //ie ascending
+					right_bound->vertex_top = local_minima->vertex->Next();  //ie ascending
 				right_bound->top = right_bound->vertex_top->pt;
 				right_bound->outrec = nullptr;
 				right_bound->local_min = local_minima;
@@ -1362,7 +1828,7 @@ namespace Clipper2Lib {
 	OutPt* ClipperBase::AddLocalMinPoly(Active& e1, Active& e2,
 		const Point64& pt, bool is_new)
 	{
-		OutRec* outrec = new OutRec();
+		OutRec* outrec = exec_arena_.New<OutRec>();
 		outrec->idx = (unsigned)outrec_list_.size();
 		outrec_list_.push_back(outrec);
 		outrec->pts = nullptr;
@@ -1373,7 +1839,16 @@ namespace Clipper2Lib {
 		//flag when orientation needs to be rechecked later ...
 		e2.outrec = outrec;
 
-		if (!IsOpen(e1))
+		if (IsOpen(e1))
+		{
+			//open paths have no orientation, but their sides must still be tracked
+			//so they can be rejoined at maxima (see JoinOutrecPaths) ...
+			if (e1.wind_dx > 0)
+				SetSides(*outrec, e1, e2);
+			else
+				SetSides(*outrec, e2, e1);
+		}
+		else
 		{
 			//Setting the owner and inner/outer states (above) is an essential
 			//precursor to setting edge 'sides' (ie left and right sides of output
@@ -1383,7 +1858,7 @@ namespace Clipper2Lib {
 			else
 				SetSides(*outrec, e2, e1);
 		}
-		OutPt* op = new OutPt(pt, outrec);
+		OutPt* op = exec_arena_.New<OutPt>(pt, outrec);
 		outrec->pts = op;
 		return op;
 	}
@@ -1419,6 +1894,16 @@ namespace Clipper2Lib {
 
 	OutPt* ClipperBase::AddLocalMaxPoly(Active& e1, Active& e2, const Point64& pt)
 	{
+		//one end of an open path may already have been terminated (see
+		//IntersectEdges), so there's nothing to join and the other end just ends
+		if (IsOpen(e1) && (!e1.outrec || !e2.outrec))
+		{
+			Active& hot_edge = e1.outrec ? e1 : e2;
+			OutPt* result = AddOutPt(hot_edge, pt);
+			TerminateOpenPath(hot_edge);
+			return result;
+		}
+
 		if (IsFront(e1) == IsFront(e2))
 		{
 			if (IsOpen(e1))
@@ -1462,11 +1947,10 @@ namespace Clipper2Lib {
 			p2_st->next = p1_end;
 			p1_end->prev = p2_st;
 			e1.outrec->pts = p2_st;
-			if (!IsOpen(e1))
-			{
-				e1.outrec->front_edge = e2.outrec->front_edge;
+			e1.outrec->front_edge = e2.outrec->front_edge;
+			//an open path's other end may already have been terminated
+			if (e1.outrec->front_edge)
 				e1.outrec->front_edge->outrec = e1.outrec;
-			}
 		}
 		else
 		{
@@ -1474,11 +1958,9 @@ namespace Clipper2Lib {
 			p2_st->next = p1_end;
 			p1_st->next = p2_end;
 			p2_end->prev = p1_st;
-			if (!IsOpen(e1))
-			{
-				e1.outrec->back_edge = e2.outrec->back_edge;
+			e1.outrec->back_edge = e2.outrec->back_edge;
+			if (e1.outrec->back_edge)
 				e1.outrec->back_edge->outrec = e1.outrec;
-			}
 		}
 
 		//after joining, the e2.OutRec must contains no vertices ...
@@ -1516,7 +1998,7 @@ namespace Clipper2Lib {
 			new_op = op_back;
 		else
 		{
-			new_op = new OutPt(pt, outrec);
+			new_op = exec_arena_.New<OutPt>(pt, outrec);
 			op_back->prev = new_op;
 			new_op->prev = op_front;
 			new_op->next = op_back;
@@ -1615,7 +2097,7 @@ namespace Clipper2Lib {
 		}
 		else
 		{
-			OutPt* newOp2 = new OutPt(ip, prevOp->outrec);
+			OutPt* newOp2 = exec_arena_.New<OutPt>(ip, prevOp->outrec);
 			newOp2->prev = prevOp;
 			newOp2->next = nextNextOp;
 			nextNextOp->prev = newOp2;
@@ -1630,7 +2112,7 @@ namespace Clipper2Lib {
 			((absArea2 > std::abs(abs(area1)) ||
 				((area2 > 0) == (area1 > 0)))))
 		{
-			OutRec* newOutRec = new OutRec();
+			OutRec* newOutRec = exec_arena_.New<OutRec>();
 			newOutRec->idx = outrec_list_.size();
 			outrec_list_.push_back(newOutRec);
 			newOutRec->owner = prevOp->outrec->owner;
@@ -1639,18 +2121,15 @@ namespace Clipper2Lib {
 			splitOp->outrec = newOutRec;
 			splitOp->next->outrec = newOutRec;
 
-			OutPt* newOp = new OutPt(ip, newOutRec);
+			OutPt* newOp = exec_arena_.New<OutPt>(ip, newOutRec);
 			newOp->prev = splitOp->next;
 			newOp->next = splitOp;
 			newOutRec->pts = newOp;
 			splitOp->prev = newOp;
 			splitOp->next->next = newOp;
 		}
-		else
-		{
-			delete splitOp->next;
-			delete splitOp;
-		}
+		//nb: when splitOp and splitOp.next aren't reused they're simply
+		//abandoned (they'll be released with exec_arena_ in CleanUp)
 		return result;
 	}
 
@@ -1704,9 +2183,7 @@ namespace Clipper2Lib {
 		while (op)
 		{
 			SafeDeleteOutPtJoiners(op);
-			OutPt* tmp = op->next;
-			delete op;
-			op = tmp;
+			op = op->next;
 		}
 	}
 
@@ -1727,7 +2204,7 @@ namespace Clipper2Lib {
 		}
 		else
 		{
-			OutRec* newOr = new OutRec();
+			OutRec* newOr = exec_arena_.New<OutRec>();
 			newOr->idx = outrec_list_.size();
 			outrec_list_.push_back(newOr);
 			newOr->polypath = nullptr;
@@ -1771,7 +2248,7 @@ namespace Clipper2Lib {
 
 	OutPt* ClipperBase::StartOpenPath(Active& e, const Point64& pt)
 	{
-		OutRec* outrec = new OutRec();
+		OutRec* outrec = exec_arena_.New<OutRec>();
 		outrec->idx = outrec_list_.size();
 		outrec_list_.push_back(outrec);
 		outrec->owner = nullptr;
@@ -1780,9 +2257,13 @@ namespace Clipper2Lib {
 		outrec->polypath = nullptr;
 		outrec->back_edge = nullptr;
 		outrec->front_edge = nullptr;
+		if (e.wind_dx > 0)
+			outrec->front_edge = &e;
+		else
+			outrec->back_edge = &e;
 		e.outrec = outrec;
 
-		OutPt* op = new OutPt(pt, outrec);
+		OutPt* op = exec_arena_.New<OutPt>(pt, outrec);
 		outrec->pts = op;
 		return op;
 	}
@@ -1850,7 +2331,7 @@ namespace Clipper2Lib {
 #ifdef USINGZ
 				if (zfill_func_) SetZ(e1, e2, resultOp->pt);
 #endif
-				edge_o->outrec = nullptr;
+				TerminateOpenPath(*edge_o);
 			}
 			else
 			{
@@ -2046,56 +2527,493 @@ namespace Clipper2Lib {
 		else
 			actives_ = next;
 		if (next) next->prev_in_ael = prev;
-		delete& e;
 	}
 
 
 	inline void ClipperBase::AdjustCurrXAndCopyToSEL(const int64_t top_y)
 	{
-		Active* e = actives_;
-		sel_ = e;
-		while (e)
+		//pack each edge's position data into arrays so the new curr_x values can
+		//all be calculated together (see TopXs) ...
+		ael_edges_.clear();
+		ael_x_.clear();
+		ael_dx_.clear();
+		ael_dy_.clear();
+		for (Active* e = actives_; e; e = e->next_in_ael)
+		{
+			ael_edges_.push_back(e);
+			ael_dx_.push_back(e->dx);
+			if ((top_y == e->top.y) || (e->top.x == e->bot.x))
+			{
+				ael_x_.push_back(e->top.x);
+				ael_dy_.push_back(0.0);
+			}
+			else
+			{
+				ael_x_.push_back(e->bot.x);
+				ael_dy_.push_back(static_cast<double>(top_y - e->bot.y));
+			}
+		}
+		TopXs(ael_x_.data(), ael_dx_.data(), ael_dy_.data(), ael_x_.size());
+#ifdef USINGSTATS
+		stats_.max_ael_count = std::max(stats_.max_ael_count, ael_edges_.size());
+#endif
+
+		sel_ = actives_;
+		size_t i = 0;
+		for (Active* e : ael_edges_)
 		{
 			e->prev_in_sel = e->prev_in_ael;
 			e->next_in_sel = e->next_in_ael;
 			e->jump = e->next_in_sel;
-			e->curr_x = TopX(*e, top_y);
-			e = e->next_in_ael;
+			e->curr_x = ael_x_[i++];
 		}
 	}
 
 
+	void ClipperBase::FindSelRanges()
+	{
+		//Find the (smallest) ranges of edges that must be sorted to order all edges
+		//by their new curr_x. Every edge outside these ranges is already in place,
+		//ie no other edge crosses it in the current scanbeam.
+		sel_ranges_.clear();
+		const int64_t* x = ael_x_.data();
+		const size_t cnt = ael_x_.size();
+		size_t i = 0;
+		while ((i = FindInversion(x, i, cnt)) < cnt)
+		{
+			SelRange range{ i, i + 1, x[i + 1], x[i] };
+			for (;;)
+			{
+				size_t first = range.first, last = range.last;
+				//extend left (merging with preceding ranges) while edges to the left
+				//are further right than the range's leftmost edge
+				while (range.first > 0)
+				{
+					if (!sel_ranges_.empty() && sel_ranges_.back().last == range.first - 1)
+					{
+						const SelRange& prev = sel_ranges_.back();
+						if (prev.max_x <= range.min_x) break;
+						range.first = prev.first;
+						range.min_x = std::min(range.min_x, prev.min_x);
+						range.max_x = std::max(range.max_x, prev.max_x);
+						sel_ranges_.pop_back();
+					}
+					else if (x[range.first - 1] > range.min_x)
+						range.max_x = std::max(range.max_x, x[--range.first]);
+					else break;
+				}
+				//and extend right while edges to the right are further left
+				while (range.last + 1 < cnt && x[range.last + 1] < range.max_x)
+					range.min_x = std::min(range.min_x, x[++range.last]);
+				if (range.first == first && range.last == last) break;
+			}
+			sel_ranges_.push_back(range);
+			i = range.last + 1;
+		}
+	}
+
+
+	inline bool AreSeparate(const Rect64& rec1, const Rect64& rec2)
+	{
+		return rec1.right < rec2.left || rec2.right < rec1.left ||
+			rec1.bottom < rec2.top || rec2.bottom < rec1.top;
+	}
+
+
+	bool ClipperBase::CullInputPaths(ClipType ct)
+	{
+		//Paths that are separated from the bounds of the other operand can't
+		//contribute to intersections, and clips separated from all subjects
+		//won't change differences, so these paths can be ignored (ie culled).
+		//Returns false when there's nothing left to clip.
+		has_culled_paths_ = false;
+		for (InputPath& input_path : input_paths_) input_path.is_culled = false;
+		if (ct != ClipType::Intersection && ct != ClipType::Difference) return true;
+
+		Rect64 subj_rec, clip_rec;
+		bool has_subjects = false, has_clips = false;
+		for (const InputPath& input_path : input_paths_)
+		{
+			const Rect64& rec = input_path.bounds;
+			bool& has_paths = (input_path.polytype == PathType::Subject) ?
+				has_subjects : has_clips;
+			Rect64& paths_rec = (input_path.polytype == PathType::Subject) ?
+				subj_rec : clip_rec;
+			if (!has_paths) paths_rec = rec;
+			else paths_rec = Rect64(std::min(paths_rec.left, rec.left),
+				std::min(paths_rec.top, rec.top), std::max(paths_rec.right, rec.right),
+				std::max(paths_rec.bottom, rec.bottom));
+			has_paths = true;
+		}
+		if (!has_clips) return ct == ClipType::Difference;
+		if (!has_subjects) return false;
+
+		size_t subj_cnt = 0, clip_cnt = 0;
+		for (InputPath& input_path : input_paths_)
+		{
+			if (input_path.polytype == PathType::Clip)
+				input_path.is_culled = AreSeparate(input_path.bounds, subj_rec);
+			else if (ct == ClipType::Intersection)
+				input_path.is_culled = AreSeparate(input_path.bounds, clip_rec);
+			if (input_path.is_culled)
+				has_culled_paths_ = true;
+			else if (input_path.polytype == PathType::Subject)
+				++subj_cnt;
+			else
+				++clip_cnt;
+		}
+		return subj_cnt > 0 && (clip_cnt > 0 || ct == ClipType::Difference);
+	}
+
+
 	bool ClipperBase::ExecuteInternal(ClipType ct, FillRule fillrule)
 	{
 		fillrule_ = fillrule;
 		cliptype_ = ct;
+		//nb: unions and xors can't cull paths that are separated from the other
+		//operand since these paths may still overlap or self-intersect
+		CLIPPER_PROFILE("ExecuteInternal");
+		const bool has_paths = CullInputPaths(ct);
 		Reset();
+		status_ = ExecuteStatus::Success;
+#ifdef USINGSTATS
+		stats_ = ExecuteStats();
+#endif
 		int64_t y;
-		if (ct == ClipType::None || !PopScanline(y)) return true;
+		if (ct == ClipType::None || !has_paths || !PopScanline(y)) return true;
 
+		size_t scanbeam_cnt = 0;
 		while (!error_found_)
 		{
-			InsertLocalMinimaIntoAEL(y);
+			if (IsAbandoned(scanbeam_cnt++)) return false;
 			Active* e;
-			while (PopHorz(e)) DoHorizontal(*e);
-			if (horz_joiners_) ConvertHorzTrialsToJoins();
+			{
+				STATS_TIMER(insert_local_minima_ns);
+				InsertLocalMinimaIntoAEL(y);
+			}
+			{
+				STATS_TIMER(horizontals_ns);
+				while (PopHorz(e))
+				{
+					STATS_ADD(horizontals, 1);
+					DoHorizontal(*e);
+				}
+				if (horz_joiners_) ConvertHorzTrialsToJoins();
+			}
 			bot_y_ = y;  //bot_y_ == bottom of scanbeam
 			if (!PopScanline(y)) break;  //y new top of scanbeam
-			DoIntersections(y);
-			DoTopOfScanbeam(y);
-			while (PopHorz(e)) DoHorizontal(*e);
+			STATS_ADD(scanbeams, 1);
+			{
+				STATS_TIMER(intersections_ns);
+				DoIntersections(y);
+			}
+			{
+				STATS_TIMER(top_of_scanbeam_ns);
+				DoTopOfScanbeam(y);
+			}
+			{
+				STATS_TIMER(horizontals_ns);
+				while (PopHorz(e))
+				{
+					STATS_ADD(horizontals, 1);
+					DoHorizontal(*e);
+				}
+			}
+		}
+		{
+			STATS_TIMER(joins_ns);
+			CLIPPER_PROFILE("ProcessJoinerList");
+			ProcessJoinerList();
 		}
-		ProcessJoinerList();
+		if (error_found_) status_ = ExecuteStatus::Error;
 		return !error_found_;
 	}
 
 
+	inline bool ClipperBase::IsAbandoned(size_t scanbeam_cnt)
+	{
+		static const size_t ScanbeamsPerClockCheck = 256;
+		if (Cancellation.IsCancelled())
+			status_ = ExecuteStatus::Cancelled;
+		else if (scanbeam_cnt % ScanbeamsPerClockCheck == 0 &&
+			Deadline != std::chrono::steady_clock::time_point::max() &&
+			std::chrono::steady_clock::now() >= Deadline)
+				status_ = ExecuteStatus::TimedOut;
+		else
+			return false;
+		error_found_ = true;
+		return true;
+	}
+
+
+	//------------------------------------------------------------------------------
+	// Multi-threaded clipping in horizontal bands (see ThreadCount) ...
+	//------------------------------------------------------------------------------
+
+	static const size_t MinVerticesPerBand = 10000;
+	static const size_t MaxBandSampleSize = 4096;
+
+	inline int64_t GetXAtY(const Point64& pt1, const Point64& pt2, int64_t y)
+	{
+		//nb: the result doesn't depend on the order of pt1 and pt2 so that
+		//neighbouring bands will always agree where edges cross their boundary
+		const Point64& lo = (pt1.y < pt2.y) ? pt1 : pt2;
+		const Point64& hi = (pt1.y < pt2.y) ? pt2 : pt1;
+		if (y == lo.y) return lo.x;
+		else if (y == hi.y) return hi.x;
+		return lo.x + static_cast<int64_t>(std::round(static_cast<double>(hi.x - lo.x) *
+			static_cast<double>(y - lo.y) / static_cast<double>(hi.y - lo.y)));
+	}
+
+
+	void GetVertexPath(const Vertex* first, Path64& path)
+	{
+		path.clear();
+		const Vertex* v = first;
+		do
+		{
+			path.push_back(v->pt);
+			v = v->Next();
+		} while (v != first);
+	}
+
+
+	void GetBandPath(const Vertex* first, int64_t top, int64_t bottom, Path64& path)
+	{
+		//Clips a closed path to the band between top and bottom (inclusive). Like
+		//Sutherland-Hodgman clipping, the parts of the path that are outside the
+		//band are replaced with segments along the band's edges. This preserves
+		//winding numbers inside the band.
+		path.clear();
+		const Vertex* v = first;
+		do
+		{
+			const Point64& pt = v->pt;
+			const Point64& next_pt = v->Next()->pt;
+			if (pt.y < top)
+			{
+				if (next_pt.y > top)
+				{
+					path.push_back(Point64(GetXAtY(pt, next_pt, top), top));
+					if (next_pt.y > bottom)
+						path.push_back(Point64(GetXAtY(pt, next_pt, bottom), bottom));
+				}
+			}
+			else if (pt.y > bottom)
+			{
+				if (next_pt.y < bottom)
+				{
+					path.push_back(Point64(GetXAtY(pt, next_pt, bottom), bottom));
+					if (next_pt.y < top)
+						path.push_back(Point64(GetXAtY(pt, next_pt, top), top));
+				}
+			}
+			else
+			{
+				path.push_back(pt);
+				if (next_pt.y < top && pt.y > top)
+					path.push_back(Point64(GetXAtY(pt, next_pt, top), top));
+				else if (next_pt.y > bottom && pt.y < bottom)
+					path.push_back(Point64(GetXAtY(pt, next_pt, bottom), bottom));
+			}
+			v = v->Next();
+		} while (v != first);
+	}
+
+
+#ifdef USINGSTATS
+	static void AddStats(ExecuteStats& stats, const ExecuteStats& other)
+	{
+		stats.scanbeams += other.scanbeams;
+		stats.local_minima += other.local_minima;
+		stats.horizontals += other.horizontals;
+		stats.intersections += other.intersections;
+		stats.joiners_created += other.joiners_created;
+		stats.joiners_processed += other.joiners_processed;
+		stats.max_ael_count = std::max(stats.max_ael_count, other.max_ael_count);
+		stats.output_vertices += other.output_vertices;
+		stats.insert_local_minima_ns += other.insert_local_minima_ns;
+		stats.horizontals_ns += other.horizontals_ns;
+		stats.intersections_ns += other.intersections_ns;
+		stats.top_of_scanbeam_ns += other.top_of_scanbeam_ns;
+		stats.joins_ns += other.joins_ns;
+		stats.build_paths_ns += other.build_paths_ns;
+	}
+#endif
+
+
+	size_t ClipperBase::GetBandCount() const
+	{
+		if (ThreadCount < 2 || has_open_paths_) return 1;
+		size_t vertex_cnt = 0;
+		for (const InputPath& input_path : input_paths_)
+			vertex_cnt += input_path.vertex_cnt;
+		return std::max<size_t>(1,
+			std::min<size_t>(ThreadCount, vertex_cnt / MinVerticesPerBand));
+	}
+
+
+	bool ClipperBase::ExecuteInBands(ClipType ct, FillRule fillrule,
+		size_t band_cnt, Paths64& solution_closed)
+	{
+		//Every band is clipped independently (with its own Clipper64 object) and
+		//since winding numbers are preserved inside each band, each band's
+		//solution will match the full solution within that band. Band solutions
+		//that touch band boundaries are then merged with a final union.
+		arena_usage_ = ArenaStats();
+		status_ = ExecuteStatus::Success;
+#ifdef USINGSTATS
+		stats_ = ExecuteStats();
+#endif
+		if (input_paths_.empty()) return true;
+
+		//choose band boundaries so that bands contain similar numbers of vertices
+		size_t vertex_cnt = 0;
+		int64_t min_y = input_paths_[0].bounds.top;
+		int64_t max_y = input_paths_[0].bounds.bottom;
+		for (const InputPath& input_path : input_paths_)
+		{
+			vertex_cnt += input_path.vertex_cnt;
+			min_y = std::min(min_y, input_path.bounds.top);
+			max_y = std::max(max_y, input_path.bounds.bottom);
+		}
+		const size_t sample_step = std::max<size_t>(1, vertex_cnt / MaxBandSampleSize);
+		std::vector<int64_t> sample_ys;
+		size_t vertex_idx = 0;
+		for (const InputPath& input_path : input_paths_)
+		{
+			const Vertex* v = input_path.first;
+			do
+			{
+				if (vertex_idx++ % sample_step == 0) sample_ys.push_back(v->pt.y);
+				v = v->Next();
+			} while (v != input_path.first);
+		}
+		std::sort(sample_ys.begin(), sample_ys.end());
+
+		std::vector<int64_t> band_ys;  //band i is between band_ys[i] & band_ys[i+1]
+		band_ys.push_back(min_y);
+		for (size_t i = 1; i < band_cnt; ++i)
+		{
+			int64_t y = sample_ys[i * sample_ys.size() / band_cnt];
+			if (y > band_ys.back() && y < max_y) band_ys.push_back(y);
+		}
+		band_ys.push_back(max_y);
+		band_cnt = band_ys.size() - 1;
+
+		std::vector<Paths64> band_solutions(band_cnt);
+		std::vector<ExecuteStatus> band_statuses(band_cnt, ExecuteStatus::Error);
+#ifdef USINGSTATS
+		std::vector<ExecuteStats> band_stats(band_cnt);
+#endif
+		ParallelFor(band_cnt, ThreadCount, [&](size_t band_idx)
+		{
+			CLIPPER_PROFILE("Band");
+			const int64_t top = band_ys[band_idx], bottom = band_ys[band_idx + 1];
+			Paths64 subjects, clips;
+			Path64 path;
+			for (const InputPath& input_path : input_paths_)
+			{
+				if (input_path.bounds.bottom <= top || input_path.bounds.top >= bottom)
+					continue;
+				if (input_path.bounds.top >= top && input_path.bounds.bottom <= bottom)
+					GetVertexPath(input_path.first, path);
+				else
+					GetBandPath(input_path.first, top, bottom, path);
+				if (path.size() < 3) continue;
+				if (input_path.polytype == PathType::Subject)
+					subjects.push_back(std::move(path));
+				else
+					clips.push_back(std::move(path));
+				path = Path64();
+			}
+
+			Clipper64 clipper;
+			clipper.PreserveCollinear = PreserveCollinear;
+			clipper.Cancellation = Cancellation;
+			clipper.Deadline = Deadline;
+#ifdef USINGZ
+			clipper.ZFillFunction(zfill_func_);
+#endif
+			clipper.AddSubject(subjects);
+			clipper.AddClip(clips);
+			clipper.Execute(ct, fillrule, band_solutions[band_idx]);
+			band_statuses[band_idx] = clipper.Status();
+#ifdef USINGSTATS
+			band_stats[band_idx] = clipper.Stats();
+#endif
+		});
+#ifdef USINGSTATS
+		for (const ExecuteStats& stats : band_stats) AddStats(stats_, stats);
+#endif
+		for (ExecuteStatus band_status : band_statuses)
+			if (band_status != ExecuteStatus::Success)
+			{
+				status_ = band_status;
+				return false;
+			}
+
+		//now merge those band solutions that touch band boundaries
+		Paths64 boundary_paths;
+		for (size_t band_idx = 0; band_idx < band_cnt; ++band_idx)
+		{
+			const int64_t top = band_ys[band_idx], bottom = band_ys[band_idx + 1];
+			const bool has_top = band_idx > 0, has_bottom = band_idx + 1 < band_cnt;
+			for (Path64& path : band_solutions[band_idx])
+			{
+				bool touches_boundary = false;
+				for (const Point64& pt : path)
+					if ((has_top && pt.y == top) || (has_bottom && pt.y == bottom))
+					{
+						touches_boundary = true;
+						break;
+					}
+				if (touches_boundary)
+					boundary_paths.push_back(std::move(path));
+				else
+					solution_closed.push_back(std::move(path));
+			}
+		}
+		if (boundary_paths.empty()) return true;
+
+		//nb: solutions using the Negative fill rule have reversed orientation
+		CLIPPER_PROFILE("MergeBands");
+		Clipper64 clipper;
+		clipper.PreserveCollinear = PreserveCollinear;
+		clipper.Cancellation = Cancellation;
+		clipper.Deadline = Deadline;
+#ifdef USINGZ
+		clipper.ZFillFunction(zfill_func_);
+#endif
+		clipper.AddSubject(boundary_paths);
+		Paths64 merged_paths;
+		if (!clipper.Execute(ClipType::Union, (fillrule == FillRule::Negative) ?
+			FillRule::Negative : FillRule::NonZero, merged_paths))
+		{
+			status_ = clipper.Status();
+			return false;
+		}
+#ifdef USINGSTATS
+		AddStats(stats_, clipper.Stats());
+#endif
+		solution_closed.insert(solution_closed.end(),
+			std::make_move_iterator(merged_paths.begin()),
+			std::make_move_iterator(merged_paths.end()));
+		return true;
+	}
+
+
 	bool ClipperBase::Execute(ClipType clip_type,
 		FillRule fill_rule, Paths64& solution_closed)
 	{
+		CLIPPER_PROFILE("Execute");
 		solution_closed.clear();
+		size_t band_cnt = GetBandCount();
+		if (band_cnt > 1 && clip_type != ClipType::None)
+			return ExecuteInBands(clip_type, fill_rule, band_cnt, solution_closed);
 		if (ExecuteInternal(clip_type, fill_rule))
 			BuildPaths(solution_closed, nullptr);
+		arena_usage_ = exec_arena_.Stats();
 		CleanUp();
 		return !error_found_;
 	}
@@ -2104,10 +3022,15 @@ namespace Clipper2Lib {
 	bool ClipperBase::Execute(ClipType clip_type, FillRule fill_rule,
 		Paths64& solution_closed, Paths64& solution_open)
 	{
+		CLIPPER_PROFILE("Execute");
 		solution_closed.clear();
 		solution_open.clear();
+		size_t band_cnt = GetBandCount();
+		if (band_cnt > 1 && clip_type != ClipType::None)
+			return ExecuteInBands(clip_type, fill_rule, band_cnt, solution_closed);
 		if (ExecuteInternal(clip_type, fill_rule))
 			BuildPaths(solution_closed, &solution_open);
+		arena_usage_ = exec_arena_.Stats();
 		CleanUp();
 		return !error_found_;
 	}
@@ -2116,11 +3039,13 @@ namespace Clipper2Lib {
 	bool ClipperBase::Execute(ClipType clip_type,
 		FillRule fill_rule, PolyTree64& polytree, Paths64& solution_open)
 	{
+		CLIPPER_PROFILE("Execute");
 		using_polytree = true;
 		polytree.Clear();
 		solution_open.clear();
 		if (ExecuteInternal(clip_type, fill_rule))
 			BuildTree(polytree, solution_open);
+		arena_usage_ = exec_arena_.Stats();
 		CleanUp();
 		return !error_found_;
 	}
@@ -2130,6 +3055,7 @@ namespace Clipper2Lib {
 	{
 		if (BuildIntersectList(top_y))
 		{
+			STATS_ADD(intersections, intersect_nodes_.size());
 			ProcessIntersectList();
 			DisposeIntersectNodes();
 		}
@@ -2138,8 +3064,8 @@ namespace Clipper2Lib {
 
 	inline void ClipperBase::DisposeIntersectNodes()
 	{
-		for (auto node : intersect_nodes_) delete node;
 		intersect_nodes_.resize(0);
+		intersect_nodes_buffer_.resize(0);
 	}
 
 
@@ -2173,7 +3099,7 @@ namespace Clipper2Lib {
 				pt.x = e2.curr_x;
 		}
 
-		intersect_nodes_.push_back(new IntersectNode(&e1, &e2, pt));
+		intersect_nodes_.emplace_back(&e1, &e2, pt);
 	}
 
 
@@ -2185,53 +3111,74 @@ namespace Clipper2Lib {
 		//we will determine the intersections required to reach these new positions.
 		AdjustCurrXAndCopyToSEL(top_y);
 
+		//Only edges that have crossed other edges need sorting, and these are
+		//grouped into ranges that can be sorted independently.
+		FindSelRanges();
+
 		//Find all edge intersections in the current scanbeam using a stable merge
 		//sort that ensures only adjacent edges are intersecting. Intersect info is
 		//stored in FIntersectList ready to be processed in ProcessIntersectList.
 		//Re merge sorts see https://stackoverflow.com/a/46319131/359538
 
-		Active* left = sel_, * right, * l_end, * r_end, * curr_base, * tmp;
-
-		while (left && left->jump)
+		for (const SelRange& range : sel_ranges_)
 		{
-			Active* prev_base = nullptr;
+			//detach the range's edges from the rest of the SEL
+			sel_ = ael_edges_[range.first];
+			sel_->prev_in_sel = nullptr;
+			ael_edges_[range.last]->next_in_sel = nullptr;
+			ael_edges_[range.last]->jump = nullptr;
+
+			Active* left = sel_, * right, * l_end, * r_end, * curr_base, * tmp;
+
 			while (left && left->jump)
 			{
-				curr_base = left;
-				right = left->jump;
-				l_end = right;
-				r_end = right->jump;
-				left->jump = r_end;
-				while (left != l_end && right != r_end)
+				Active* prev_base = nullptr;
+				while (left && left->jump)
 				{
-					if (right->curr_x < left->curr_x)
+					curr_base = left;
+					right = left->jump;
+					l_end = right;
+					r_end = right->jump;
+					left->jump = r_end;
+					while (left != l_end && right != r_end)
 					{
-						tmp = right->prev_in_sel;
-						for (; ; )
+						if (right->curr_x < left->curr_x)
 						{
-							AddNewIntersectNode(*tmp, *right, top_y);
-							if (tmp == left) break;
-							tmp = tmp->prev_in_sel;
-						}
-
-						tmp = right;
-						right = ExtractFromSEL(tmp);
-						l_end = right;
-						Insert1Before2InSEL(tmp, left);
-						if (left == curr_base)
-						{
-							curr_base = tmp;
-							curr_base->jump = r_end;
-							if (!prev_base) sel_ = curr_base;
-							else prev_base->jump = curr_base;
+							tmp = right->prev_in_sel;
+							for (; ; )
+							{
+								AddNewIntersectNode(*tmp, *right, top_y);
+								if (tmp == left) break;
+								tmp = tmp->prev_in_sel;
+							}
+
+							tmp = right;
+							right = ExtractFromSEL(tmp);
+							l_end = right;
+							Insert1Before2InSEL(tmp, left);
+							if (left == curr_base)
+							{
+								curr_base = tmp;
+								curr_base->jump = r_end;
+								if (!prev_base) sel_ = curr_base;
+								else prev_base->jump = curr_base;
+							}
 						}
+						else left = left->next_in_sel;
 					}
-					else left = left->next_in_sel;
+					prev_base = curr_base;
+					left = r_end;
 				}
-				prev_base = curr_base;
-				left = r_end;
+				left = sel_;
+			}
+
+			//update the packed AEL data to reflect the sorted order
+			Active* e = sel_;
+			for (size_t i = range.first; i <= range.last; ++i, e = e->next_in_sel)
+			{
+				ael_edges_[i] = e;
+				ael_x_[i] = e->curr_x;
 			}
-			left = sel_;
 		}
 		return intersect_nodes_.size() > 0;
 	}
@@ -2244,25 +3191,27 @@ namespace Clipper2Lib {
 		//that edge intersections are processed from the bottom up, but it's also
 		//crucial that intersections only occur between adjacent edges.
 
-		//First we do a quicksort so intersections proceed in a bottom up order ...
-		std::sort(intersect_nodes_.begin(), intersect_nodes_.end(), IntersectListSort);
+		//First we sort so intersections proceed in a bottom up order ...
+		SortIntersectNodes(intersect_nodes_, intersect_nodes_buffer_);
 		//Now as we process these intersections, we must sometimes adjust the order
 		//to ensure that intersecting edges are always adjacent ...
+		//(nb: once sorted, very few nodes aren't already adjacent, and an adjacent
+		//node is almost always the next one, so this simple search is rarely costly)
 
-		std::vector<IntersectNode*>::iterator node_iter, node_iter2;
+		std::vector<IntersectNode>::iterator node_iter, node_iter2;
 		for (node_iter = intersect_nodes_.begin();
 			node_iter != intersect_nodes_.end();  ++node_iter)
 		{
-			if (!EdgesAdjacentInAEL(*(*node_iter)))
+			if (!EdgesAdjacentInAEL(*node_iter))
 			{
 				node_iter2 = node_iter + 1;
 				while (node_iter2 != intersect_nodes_.end() &&
-					!EdgesAdjacentInAEL(*(*node_iter2))) ++node_iter2;
+					!EdgesAdjacentInAEL(*node_iter2)) ++node_iter2;
 				if (node_iter2 != intersect_nodes_.end())
 					std::swap(*node_iter, *node_iter2);
 			}
 
-			IntersectNode* node = *node_iter;
+			const IntersectNode* node = &(*node_iter);
 			IntersectEdges(*node->edge1, *node->edge2, node->pt);
 			SwapPositionsInAEL(*node->edge1, *node->edge2);
 
@@ -2594,7 +3543,7 @@ namespace Clipper2Lib {
 			if (IsHotEdge(e)) AddOutPt(e, e.top);
 			if (!IsHorizontal(e))
 			{
-				if (IsHotEdge(e)) e.outrec = nullptr;
+				if (IsHotEdge(e)) TerminateOpenPath(e);
 				DeleteFromAEL(e);
 			}
 			return next_e;
@@ -2687,7 +3636,7 @@ namespace Clipper2Lib {
 	{
 		//make sure 'op' isn't added more than once
 		if (!OutPtInTrialHorzList(op))
-			horz_joiners_ = new Joiner(op, nullptr, horz_joiners_);
+			horz_joiners_ = exec_arena_.New<Joiner>(op, nullptr, horz_joiners_);
 	}
 
 
@@ -2745,7 +3694,6 @@ namespace Clipper2Lib {
 				{
 					//joiner must be first one in list
 					op->joiner = joiner->next1;
-					delete joiner;
 					joiner = op->joiner;
 				}
 				else
@@ -2755,7 +3703,6 @@ namespace Clipper2Lib {
 						parentOp->next1 = joiner->next1;
 					else
 						parentOp->next2 = joiner->next1;
-					delete joiner;
 					joiner = parentOp;
 				}
 			}
@@ -2875,7 +3822,6 @@ namespace Clipper2Lib {
 				else
 					joinerParent->next2 = joiner->next1;
 			}
-			delete joiner;
 
 			OutPt* op1b;
 			if (!GetHorzExtendedHorzSeg(op1a, op1b))
@@ -2903,13 +3849,13 @@ namespace Clipper2Lib {
 					else if (op1b->pt == op2b->pt)
 						AddJoin(op1b, op2b);
 					else if (ValueBetween(op1a->pt.x, op2a->pt.x, op2b->pt.x))
-						AddJoin(op1a, InsertOp(op1a->pt, op2a));
+						AddJoin(op1a, InsertOp(op1a->pt, op2a, exec_arena_));
 					else if (ValueBetween(op1b->pt.x, op2a->pt.x, op2b->pt.x))
-						AddJoin(op1b, InsertOp(op1b->pt, op2a));
+						AddJoin(op1b, InsertOp(op1b->pt, op2a, exec_arena_));
 					else if (ValueBetween(op2a->pt.x, op1a->pt.x, op1b->pt.x))
-						AddJoin(op2a, InsertOp(op2a->pt, op1a));
+						AddJoin(op2a, InsertOp(op2a->pt, op1a, exec_arena_));
 					else if (ValueBetween(op2b->pt.x, op1a->pt.x, op1b->pt.x))
-						AddJoin(op2b, InsertOp(op2b->pt, op1a));
+						AddJoin(op2b, InsertOp(op2b->pt, op1a, exec_arena_));
 					break;
 				}
 				joiner = joiner->nextH;
@@ -2928,9 +3874,10 @@ namespace Clipper2Lib {
 			((op1->next == op2) && (op1 != op1->outrec->pts)) ||
 			((op2->next == op1) && (op2 != op1->outrec->pts)))) return;
 
-		Joiner* j = new Joiner(op1, op2, nullptr);
+		Joiner* j = exec_arena_.New<Joiner>(op1, op2, nullptr);
 		j->idx = static_cast<int>(joiner_list_.size());
 		joiner_list_.push_back(j);
+		STATS_ADD(joiners_created, 1);
 	}
 
 
@@ -2964,27 +3911,18 @@ namespace Clipper2Lib {
 			op2->joiner = joiner->next2;
 
 		joiner_list_[joiner->idx] = nullptr;
-		delete joiner;
 	}
 
 	void ClipperBase::ProcessJoinerList()
 	{
-		for (Joiner* j : joiner_list_)
-		{
-			if (!j)
-			{
-				continue;
-			}
-			else if (error_found_)
-			{
-				delete j;
-			}
-			else
+		if (!error_found_)
+			for (Joiner* j : joiner_list_)
 			{
+				if (!j) continue;
+				STATS_ADD(joiners_processed, 1);
 				OutRec* outrec = ProcessJoin(j);
 				CleanCollinear(outrec);
 			}
-		}
 		joiner_list_.resize(0);
 	}
 
@@ -3145,9 +4083,9 @@ namespace Clipper2Lib {
 					if (op1->prev->pt != op2->next->pt)
 					{
 						if (PointBetween(op1->prev->pt, op2->pt, op2->next->pt))
-							op2->next = InsertOp(op1->prev->pt, op2);
+							op2->next = InsertOp(op1->prev->pt, op2, exec_arena_);
 						else
-							op1->prev = InsertOp(op2->next->pt, op1->prev);
+							op1->prev = InsertOp(op2->next->pt, op1->prev, exec_arena_);
 					}
 
 					//current              to     new
@@ -3199,9 +4137,9 @@ namespace Clipper2Lib {
 					if (op2->prev->pt != op1->next->pt)
 					{
 						if (PointBetween(op2->prev->pt, op1->pt, op1->next->pt))
-							op1->next = InsertOp(op2->prev->pt, op1);
+							op1->next = InsertOp(op2->prev->pt, op1, exec_arena_);
 						else
-							op2->prev = InsertOp(op1->next->pt, op2->prev);
+							op2->prev = InsertOp(op1->next->pt, op2->prev, exec_arena_);
 					}
 
 					//current              to     new
@@ -3241,25 +4179,25 @@ namespace Clipper2Lib {
 			else if (PointBetween(op1->next->pt, op2->pt, op2->prev->pt) &&
 				DistanceFromLineSqrd(op1->next->pt, op2->pt, op2->prev->pt) < 2.01)
 			{
-				InsertOp(op1->next->pt, op2->prev);
+				InsertOp(op1->next->pt, op2->prev, exec_arena_);
 				continue;
 			}
 			else if (PointBetween(op2->next->pt, op1->pt, op1->prev->pt) &&
 				DistanceFromLineSqrd(op2->next->pt, op1->pt, op1->prev->pt) < 2.01)
 			{
-				InsertOp(op2->next->pt, op1->prev);
+				InsertOp(op2->next->pt, op1->prev, exec_arena_);
 				continue;
 			}
 			else if (PointBetween(op1->prev->pt, op2->pt, op2->next->pt) &&
 				DistanceFromLineSqrd(op1->prev->pt, op2->pt, op2->next->pt) < 2.01)
 			{
-				InsertOp(op1->prev->pt, op2);
+				InsertOp(op1->prev->pt, op2, exec_arena_);
 				continue;
 			}
 			else if (PointBetween(op2->prev->pt, op1->pt, op1->next->pt) &&
 				DistanceFromLineSqrd(op2->prev->pt, op1->pt, op1->next->pt) < 2.01)
 			{
-				InsertOp(op2->prev->pt, op1);
+				InsertOp(op2->prev->pt, op1, exec_arena_);
 				continue;
 			}
 
@@ -3333,6 +4271,8 @@ namespace Clipper2Lib {
 
 	void ClipperBase::BuildPaths(Paths64& solutionClosed, Paths64* solutionOpen)
 	{
+		STATS_TIMER(build_paths_ns);
+		CLIPPER_PROFILE("BuildPaths");
 		solutionClosed.resize(0);
 		solutionClosed.reserve(outrec_list_.size());
 		if (solutionOpen)
@@ -3349,14 +4289,20 @@ namespace Clipper2Lib {
 			{
 				if (BuildPath(outrec->pts, 
 					fillrule_ == FillRule::Negative, true, path))
+				{
+					STATS_ADD(output_vertices, path.size());
 					solutionOpen->emplace_back(std::move(path));
+				}
 				path.resize(0);
 			}
 			else
 			{
 				if (BuildPath(outrec->pts, 
 					fillrule_ == FillRule::Negative, false, path))
+				{
+					STATS_ADD(output_vertices, path.size());
 					solutionClosed.emplace_back(std::move(path));
+				}
 				path.resize(0);
 			}
 		}
@@ -3432,6 +4378,8 @@ namespace Clipper2Lib {
 
 	void ClipperBase::BuildTree(PolyPath64& polytree, Paths64& open_paths)
 	{
+		STATS_TIMER(build_paths_ns);
+		CLIPPER_PROFILE("BuildTree");
 		polytree.Clear();
 		open_paths.resize(0);
 		if (has_open_paths_)
@@ -3471,6 +4419,7 @@ namespace Clipper2Lib {
 			Path64 path;
 			if (!BuildPath(outrec->pts, 
 				fillrule_ == FillRule::Negative, is_open_path, path)) continue;
+			STATS_ADD(output_vertices, path.size());
 
 			if (is_open_path)
 			{
@@ -13,18 +13,24 @@
 
 #define CLIPPER2_VERSION "1.0.0"
 
+#include <atomic>
+#include <chrono>
 #include <cstdlib>
-#include <queue>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <new>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 #include "clipper.core.h"
 
 namespace Clipper2Lib {
 
 	struct Scanline;
-	struct IntersectNode;
 	struct Active;
 	struct Vertex;
+	struct OutPt;
 	struct LocalMinima;
 	struct OutRec;
 	struct Joiner;
@@ -55,19 +61,179 @@ namespace Clipper2Lib {
 		return (enum VertexFlags)(uint32_t(a) | uint32_t(b));
 	}
 
+	// Arena ------------------------------------------------------------------
+
+	//Arena: a simple 'bump' allocator that services the many small structures
+	//used by ClipperBase (Vertex, LocalMinima, Active, OutRec, OutPt and Joiner).
+	//Memory is carved sequentially from large blocks and is
+	//never returned piecemeal, instead it's all released together (in O(1) wrt
+	//the number of structures allocated) via Release().
+	//A 'linkable' arena also allows the structures it contains to reference
+	//each other with 32bit handles (see ArenaLink below). Its blocks are then
+	//all ArenaLinkBlockSize bytes and aligned to that size, with each block
+	//starting with a small header that identifies the arena and the block.
+
+	static const size_t ArenaLinkBlockBits = 16;
+	static const size_t ArenaLinkBlockSize = size_t(1) << ArenaLinkBlockBits;
+
+	struct ArenaStats {
+		size_t bytes_used = 0;      //bytes handed out (including alignment padding)
+		size_t bytes_reserved = 0;  //total size of the arena's memory blocks
+		size_t allocations = 0;     //number of structures (or arrays) handed out
+	};
+
+	class Arena {
+	private:
+		struct Block {
+			char* data;
+			size_t size;
+			void* memory;           //as allocated (data may be aligned within this)
+		};
+		struct LinkBlockHeader {
+			const Arena* arena;
+			uint32_t block_no;
+		};
+		std::vector<Block> blocks_;
+		size_t block_idx_ = 0;
+		uintptr_t curr_ = 0;
+		uintptr_t end_ = 0;
+		bool linkable_ = false;
+		ArenaStats stats_;
+		void* AllocateSlow(size_t size, size_t align);
+		void AddBlock(size_t size);
+		void FreeBlock(const Block& block) const;
+		//BlockMemorySize: the block's size as allocated (see AddBlock)
+		inline size_t BlockMemorySize(const Block& block) const
+		{
+#ifdef __cpp_aligned_new
+			return block.size;
+#else
+			return linkable_ ? block.size * 2 : block.size;
+#endif
+		}
+	public:
+		explicit Arena(bool linkable = false) : linkable_(linkable) {};
+		~Arena() { Release(); };
+		Arena(const Arena&) = delete;
+		Arena& operator=(const Arena&) = delete;
+
+		inline void* Allocate(size_t size, size_t align)
+		{
+			uintptr_t result = (curr_ + align - 1) & ~static_cast<uintptr_t>(align - 1);
+			if (!curr_ || result + size > end_) return AllocateSlow(size, align);
+			stats_.bytes_used += (result + size) - curr_;
+			++stats_.allocations;
+			curr_ = result + size;
+			return reinterpret_cast<void*>(result);
+		}
+
+		template <typename T, typename... Args>
+		T* New(Args&&... args)
+		{
+			return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+		}
+
+		template <typename T>
+		T* NewArray(size_t count)
+		{
+			T* result = static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+			for (size_t i = 0; i < count; ++i) new (result + i) T();
+			return result;
+		}
+
+		//nb: Release and Rewind don't call destructors. Only trivially destructible
+		//structures (and OutRec, see ClipperBase::DisposeAllOutRecs) are stored.
+		void Release();
+		//Rewind: like Release except the memory is kept for reuse
+		void Rewind();
+		const ArenaStats& Stats() const { return stats_; }
+
+		//ToHandle & FromHandle: (linkable arenas only) a handle combines a block
+		//number with an (8 byte aligned) offset into that block, and 0 is null.
+		static inline uint32_t ToHandle(const void* ptr)
+		{
+			if (!ptr) return 0;
+			uintptr_t addr = reinterpret_cast<uintptr_t>(ptr);
+			uintptr_t base = addr & ~static_cast<uintptr_t>(ArenaLinkBlockSize - 1);
+			const LinkBlockHeader* header = reinterpret_cast<const LinkBlockHeader*>(base);
+			return (header->block_no << (ArenaLinkBlockBits - 3)) |
+				static_cast<uint32_t>((addr - base) >> 3);
+		}
+
+		//nb: 'owner' must be the address of something in the same linkable arena
+		static inline void* FromHandle(const void* owner, uint32_t handle)
+		{
+			if (!handle) return nullptr;
+			uintptr_t base = reinterpret_cast<uintptr_t>(owner) &
+				~static_cast<uintptr_t>(ArenaLinkBlockSize - 1);
+			const LinkBlockHeader* header = reinterpret_cast<const LinkBlockHeader*>(base);
+			uint32_t block_no = handle >> (ArenaLinkBlockBits - 3);
+			//most links are to structures in the same block (ie no lookup needed)
+			if (block_no != header->block_no)
+				base = reinterpret_cast<uintptr_t>(header->arena->blocks_[block_no].data);
+			return reinterpret_cast<void*>(base +
+				((handle & ((1u << (ArenaLinkBlockBits - 3)) - 1)) << 3));
+		}
+	};
+
+	//ArenaLink: a 32bit stand-in for a T* that's only valid as a member of a
+	//structure stored in a linkable arena, and which can only point to other
+	//structures in the same arena. (It can't be copied to somewhere else.)
+	template <typename T>
+	class ArenaLink {
+	private:
+		uint32_t handle_ = 0;
+	public:
+		ArenaLink() {};
+		ArenaLink(T* ptr) : handle_(Arena::ToHandle(ptr)) {};
+		ArenaLink(const ArenaLink&) = delete;
+		ArenaLink& operator=(const ArenaLink& other) { handle_ = other.handle_; return *this; }
+		ArenaLink& operator=(T* ptr) { handle_ = Arena::ToHandle(ptr); return *this; }
+		operator T* () const { return static_cast<T*>(Arena::FromHandle(this, handle_)); }
+		T* operator->() const { return static_cast<T*>(Arena::FromHandle(this, handle_)); }
+	};
+
+#ifdef USINGINDEXEDLINKS
+	typedef ArenaLink<OutPt> OutPtLink;
+	typedef ArenaLink<OutRec> OutRecLink;
+	typedef ArenaLink<Joiner> JoinerLink;
+#else
+	typedef OutPt* OutPtLink;
+	typedef OutRec* OutRecLink;
+	typedef Joiner* JoinerLink;
+#endif
+
+	//Vertex: each path's vertices are allocated contiguously (see AddPaths) so
+	//they're linked by 32bit offsets (relative to the vertex) rather than by
+	//pointers. An offset of 0 means unassigned since a vertex is never linked
+	//to itself.
 	struct Vertex {
 		Point64 pt;
-		Vertex* next = nullptr;
-		Vertex* prev = nullptr;
+		int32_t next_offset = 0;
+		int32_t prev_offset = 0;
 		VertexFlags flags = VertexFlags::None;
+
+		Vertex* Next() const
+		{
+			return next_offset ? const_cast<Vertex*>(this) + next_offset : nullptr;
+		}
+		Vertex* Prev() const
+		{
+			return prev_offset ? const_cast<Vertex*>(this) + prev_offset : nullptr;
+		}
+		void SetNext(const Vertex* v) { next_offset = v ? static_cast<int32_t>(v - this) : 0; }
+		void SetPrev(const Vertex* v) { prev_offset = v ? static_cast<int32_t>(v - this) : 0; }
 	};
 
+	//OutPt: in USINGINDEXEDLINKS builds, OutPts (together with OutRecs and
+	//Joiners) are kept in a linkable arena and their links are 32bit handles
+	//which almost halves their size (with a small cost to each link's access).
 	struct OutPt {
 		Point64 pt;
-		OutPt*	next = nullptr;
-		OutPt*	prev = nullptr;
-		OutRec* outrec;
-		Joiner* joiner = nullptr;
+		OutPtLink next{ nullptr };
+		OutPtLink prev{ nullptr };
+		OutRecLink outrec;
+		JoinerLink joiner{ nullptr };
 
 		OutPt(const Point64& pt_, OutRec* outrec_): pt(pt_), outrec(outrec_) {
 			next = this;
@@ -105,39 +271,127 @@ namespace Clipper2Lib {
 		~OutRec() { if (splits) delete splits; };
 	};
 
-	struct Active {
-		Point64 bot;
-		Point64 top;
+	//Active: fields are grouped by how often they're accessed. The first cache
+	//line holds what's needed to update each edge's curr_x at the top of every
+	//scanbeam (see AdjustCurrXAndCopyToSEL) and when walking the AEL (eg in
+	//InsertLeftEdge and GetMaximaPair), and Active is aligned so this data
+	//never straddles two cache lines.
+	struct alignas(64) Active {
 		int64_t curr_x = 0;		//current (updated at every new scanline)
 		double dx = 0.0;
-		int wind_dx = 1;			//1 or -1 depending on winding direction
-		int wind_cnt = 0;
-		int wind_cnt2 = 0;		//winding count of the opposite polytype
-		OutRec* outrec = nullptr;
+		Point64 top;
+		Point64 bot;
 		//AEL: 'active edge list' (Vatti's AET - active edge table)
 		//     a linked list of all edges (from left to right) that are present
 		//     (or 'active') within the current scanbeam (a horizontal 'beam' that
 		//     sweeps from bottom to top over the paths in the clipping operation).
-		Active* prev_in_ael = nullptr;
 		Active* next_in_ael = nullptr;
 		//SEL: 'sorted edge list' (Vatti's ST - sorted table)
 		//     linked list used when sorting edges into their new positions at the
 		//     top of scanbeams, but also (re)used to process horizontals.
-		Active* prev_in_sel = nullptr;
 		Active* next_in_sel = nullptr;
+		//less frequently accessed fields ...
 		Active* jump = nullptr;
 		Vertex* vertex_top = nullptr;
-		LocalMinima* local_min = nullptr;  //the bottom of an edge 'bound' (also Vatti)
+		Active* prev_in_ael = nullptr;
+		Active* prev_in_sel = nullptr;
+		int wind_dx = 1;			//1 or -1 depending on winding direction
+		int wind_cnt = 0;
+		int wind_cnt2 = 0;		//winding count of the opposite polytype
 		bool is_left_bound = false;
+		OutRec* outrec = nullptr;
+		LocalMinima* local_min = nullptr;  //the bottom of an edge 'bound' (also Vatti)
+	};
+
+	//IntersectNode: intersections are stored by value (see ClipperBase::
+	//intersect_nodes_) so they can be sorted without any pointer chasing
+	struct IntersectNode {
+		Point64 pt;
+		Active* edge1;
+		Active* edge2;
+
+		IntersectNode() : pt(Point64(0, 0)), edge1(nullptr), edge2(nullptr) {}
+		IntersectNode(Active* e1, Active* e2, const Point64& pt_) :
+			pt(pt_), edge1(e1), edge2(e2) {}
+	};
+
+	//InputPath: a record of each (non-degenerate) path that's been added to
+	//ClipperBase, with the path's bounds
+	struct InputPath {
+		Vertex* first;
+		size_t vertex_cnt;
+		Rect64 bounds;
+		PathType polytype;
+		bool is_open;
+		bool is_culled;  //see CullInputPaths
 	};
 
 	struct LocalMinima {
 		Vertex* vertex;
+		size_t path_idx;  //index into ClipperBase's input paths
 		PathType polytype;
 		bool is_open;
-		LocalMinima(Vertex* v, PathType pt, bool open) :
-			vertex(v), polytype(pt), is_open(open){}
+		LocalMinima(Vertex* v, size_t idx, PathType pt, bool open) :
+			vertex(v), path_idx(idx), polytype(pt), is_open(open){}
+	};
+
+	//PreparedPaths64: paths that have been converted (just once) into the
+	//vertices, local minima and bounds that ClipperBase clips. It's immutable
+	//so it can be added to any number of clippers (see ClipperBase::
+	//AddPreparedPaths), including clippers in different threads, which is
+	//much faster than repeatedly adding the same (large) paths.
+	class PreparedPaths64 {
+	private:
+		Arena arena_;
+		std::vector<InputPath> input_paths_;
+		std::vector<LocalMinima*> minima_list_;  //sorted as in ClipperBase::Reset
+		bool is_open_;
+		friend class ClipperBase;
+	public:
+		explicit PreparedPaths64(const Paths64& paths,
+			PathType polytype = PathType::Subject, bool is_open = false);
+		PreparedPaths64(const PreparedPaths64&) = delete;
+		PreparedPaths64& operator=(const PreparedPaths64&) = delete;
+		size_t PathCount() const { return input_paths_.size(); }
+	};
+
+	//CancellationToken: allows a clipping operation (eg one started with
+	//ExecuteAsync) to be abandoned from another thread. Copies of a token share
+	//the same state, so cancelling any copy cancels them all.
+	class CancellationToken {
+	private:
+		std::shared_ptr<std::atomic<bool>> cancelled_;
+	public:
+		CancellationToken() : cancelled_(std::make_shared<std::atomic<bool>>(false)) {};
+		void Cancel() const { cancelled_->store(true, std::memory_order_relaxed); }
+		bool IsCancelled() const { return cancelled_->load(std::memory_order_relaxed); }
+	};
+
+#ifdef USINGSTATS
+	//ExecuteStats: (USINGSTATS builds only) counts and timings that describe the
+	//most recent Execute, to help identify why some operations are slow. (When
+	//clipping in bands, counts and times are summed over all bands.)
+	struct ExecuteStats {
+		size_t scanbeams = 0;
+		size_t local_minima = 0;
+		size_t horizontals = 0;
+		size_t intersections = 0;       //see BuildIntersectList
+		size_t joiners_created = 0;
+		size_t joiners_processed = 0;
+		size_t max_ael_count = 0;       //peak AEL length (at the top of scanbeams)
+		size_t output_vertices = 0;
+		//nanoseconds spent in each phase
+		int64_t insert_local_minima_ns = 0;
+		int64_t horizontals_ns = 0;
+		int64_t intersections_ns = 0;
+		int64_t top_of_scanbeam_ns = 0;
+		int64_t joins_ns = 0;
+		int64_t build_paths_ns = 0;
 	};
+#endif
+
+	//ExecuteStatus: why the most recent Execute succeeded or failed
+	enum class ExecuteStatus { Success, Error, Cancelled, TimedOut };
 
 #ifdef USINGZ
 	typedef void (*ZFillCallback)(const Point64& e1bot, const Point64& e1top, 
@@ -152,17 +406,51 @@ namespace Clipper2Lib {
 		FillRule fillrule_ = FillRule::EvenOdd;
 		int64_t bot_y_ = 0;
 		bool error_found_ = false;
+		ExecuteStatus status_ = ExecuteStatus::Success;
+#ifdef USINGSTATS
+		ExecuteStats stats_;
+#endif
 		bool has_open_paths_ = false;
 		bool minima_list_sorted_ = false;
+		bool has_culled_paths_ = false;  //see CullInputPaths
 		bool using_polytree = false;
 		Active *actives_ = nullptr;
 		Active *sel_ = nullptr;
 		Joiner *horz_joiners_ = nullptr;
 		std::vector<LocalMinima*> minima_list_;
+		std::vector<InputPath> input_paths_;
 		std::vector<LocalMinima*>::iterator loc_min_iter_;
-		std::vector<Vertex*> vertex_lists_;
-		std::priority_queue<int64_t> scanline_list_;
-		std::vector<IntersectNode*> intersect_nodes_;
+		//prepared paths (if any) are always the first of input_paths_
+		std::shared_ptr<const PreparedPaths64> prepared_paths_;
+		std::vector<LocalMinima*>::const_iterator prepared_min_iter_;
+		Arena path_arena_;  //Vertex and LocalMinima structures (see Clear)
+#ifdef USINGINDEXEDLINKS
+		Arena exec_arena_{ true };  //structures that only persist until CleanUp
+#else
+		Arena exec_arena_;  //structures that only persist until CleanUp
+#endif
+		ArenaStats arena_usage_;
+		//scanlines (ie the Y values of scanbeam boundaries) come from two sources:
+		//local minima, which are all known (and sorted) before the sweep starts,
+		//and edge tops, which are only discovered during the sweep (so are heaped)
+		std::vector<int64_t> minima_scanlines_;  //sorted & deduplicated
+		size_t minima_scanline_idx_ = 0;
+		std::vector<int64_t> scanline_list_;  //a (max) heap of edge top Y values
+		std::vector<IntersectNode> intersect_nodes_;
+		std::vector<IntersectNode> intersect_nodes_buffer_;  //used for sorting
+		//packed AEL data used to update edge positions at the top of each
+		//scanbeam, and to find where edges have swapped positions (ie crossed)
+		//see AdjustCurrXAndCopyToSEL and BuildIntersectList. Once sorted, these
+		//also index the AEL when inserting local minima (see GetAelInsertStart)
+		struct SelRange {
+			size_t first, last;
+			int64_t min_x, max_x;
+		};
+		std::vector<Active*> ael_edges_;
+		std::vector<int64_t> ael_x_;
+		std::vector<double> ael_dx_;
+		std::vector<double> ael_dy_;
+		std::vector<SelRange> sel_ranges_;
 		std::vector<Joiner*> joiner_list_;
 		void Reset();
 		void InsertScanline(int64_t y);
@@ -170,13 +458,14 @@ namespace Clipper2Lib {
 		bool PopLocalMinima(int64_t y, LocalMinima *&local_minima);
 		void DisposeAllOutRecs();
 		void DisposeVerticesAndLocalMinima();
-		void AddLocMin(Vertex &vert, PathType polytype, bool is_open);
+		bool IsRetainable(size_t bytes) const;
 		bool IsContributingClosed(const Active &e) const;
 		inline bool IsContributingOpen(const Active &e) const;
 		void SetWindCountForClosedPathEdge(Active &edge);
 		void SetWindCountForOpenPathEdge(Active &e);
 		virtual void InsertLocalMinimaIntoAEL(int64_t bot_y);
 		void InsertLeftEdge(Active &e);
+		Active* GetAelInsertStart(const Active& e) const;
 		inline void PushHorz(Active &e);
 		inline bool PopHorz(Active *&e);
 		inline OutPt* StartOpenPath(Active &e, const Point64& pt);
@@ -184,6 +473,7 @@ namespace Clipper2Lib {
 		OutPt* IntersectEdges(Active &e1, Active &e2, const Point64& pt);
 		inline void DeleteFromAEL(Active &e);
 		inline void AdjustCurrXAndCopyToSEL(const int64_t top_y);
+		void FindSelRanges();
 		void DoIntersections(const int64_t top_y);
 		void DisposeIntersectNodes();
 		void AddNewIntersectNode(Active &e1, Active &e2, const int64_t top_y);
@@ -222,8 +512,13 @@ namespace Clipper2Lib {
 		void DeleteJoin(Joiner* joiner);
 		void ProcessJoinerList();
 		OutRec* ProcessJoin(Joiner* joiner);
+		bool CullInputPaths(ClipType ct);
+		inline bool IsAbandoned(size_t scanbeam_cnt);
 		virtual bool ExecuteInternal(ClipType ct, FillRule ft);
 		void BuildPaths(Paths64& solutionClosed, Paths64* solutionOpen);
+		size_t GetBandCount() const;
+		bool ExecuteInBands(ClipType ct, FillRule fillrule,
+			size_t band_cnt, Paths64& solution_closed);
 		void BuildTree(PolyPath64& polytree, Paths64& open_paths);
 #ifdef USINGZ
 		ZFillCallback zfill_func_; //custom callback 
@@ -234,6 +529,7 @@ namespace Clipper2Lib {
 		void CleanUp();  //unlike Clear, CleanUp preserves added paths
 		void AddPath(const Path64& path, PathType polytype, bool is_open);
 		void AddPaths(const Paths64& paths, PathType polytype, bool is_open);
+		void AddPreparedPaths(const std::shared_ptr<const PreparedPaths64>& paths);
 
 		virtual bool Execute(ClipType clip_type,
 			FillRule fill_rule, Paths64& solution_closed);
@@ -244,7 +540,41 @@ namespace Clipper2Lib {
 	public:
 		virtual ~ClipperBase();
 		bool PreserveCollinear = true;
+		//ReuseMemory: when enabled, Clear and CleanUp retain all allocated memory
+		//(both container capacities and arena blocks) so that once 'warmed up',
+		//repeated Clear / AddPaths / Execute cycles won't need to allocate memory
+		//except for solutions. (Useful when performing many small operations.)
+		bool ReuseMemory = false;
+		//ReuseMemoryLimit: when not 0, the most memory (in bytes) that each of the
+		//clipper's arenas (and its intersection buffers) will retain for reuse.
+		//Any more is released, so a single very large operation won't leave a
+		//reusing clipper holding that much memory for the rest of its life.
+		size_t ReuseMemoryLimit = 0;
+		//ThreadCount: when greater than 1, large clipping operations that return
+		//closed paths (but not PolyTrees) and that have no open paths are split
+		//into horizontal bands that are clipped concurrently, with the bands'
+		//solutions then merged along the band boundaries. (Vertices are added
+		//where solution edges cross these boundaries, but otherwise solutions
+		//are geometrically the same.)
+		unsigned ThreadCount = 1;
+		//Cancellation & Deadline: these are checked between scanbeams, and when
+		//an operation is cancelled or overdue, Execute abandons it promptly
+		//(returning false, see Status) and releases all its memory. (Deadline is
+		//only checked every few hundred scanbeams since reading the clock isn't
+		//free.) Both should be set before Execute, and the token then cancelled
+		//from any thread. (Tokens stay cancelled, so a new token must be
+		//assigned before the clipper's next Execute.)
+		CancellationToken Cancellation;
+		std::chrono::steady_clock::time_point Deadline =
+			std::chrono::steady_clock::time_point::max();
+		ExecuteStatus Status() const { return status_; }
+#ifdef USINGSTATS
+		const ExecuteStats& Stats() const { return stats_; }
+#endif
 		void Clear();
+		//ArenaUsage: memory used by the most recent Execute (excluding the
+		//memory that holds the vertices and local minima of added paths)
+		const ArenaStats& ArenaUsage() const { return arena_usage_; }
 #ifdef USINGZ
 		ClipperBase() { zfill_func_ = nullptr; };
 		void ZFillFunction(ZFillCallback zFillFunc);
@@ -344,6 +674,12 @@ namespace Clipper2Lib {
 		{
 			AddPaths(clips, PathType::Clip, false);
 		}
+		//AddPrepared: adds paths that have already been prepared (see
+		//PreparedPaths64). Only one PreparedPaths64 can be added before Clear.
+		void AddPrepared(const std::shared_ptr<const PreparedPaths64>& paths)
+		{
+			AddPreparedPaths(paths);
+		}
 
 		bool Execute(ClipType clip_type,
 			FillRule fill_rule, Paths64& closed_paths) override
@@ -363,6 +699,28 @@ namespace Clipper2Lib {
 			return ClipperBase::Execute(clip_type, fill_rule, polytree, open_paths);
 		}
 
+		//ExecuteAsync: performs Execute in another thread. Neither the clipper nor
+		//the solution paths may be accessed (except to Cancel the clipper's
+		//Cancellation token) until the returned future is ready.
+		std::future<bool> ExecuteAsync(ClipType clip_type,
+			FillRule fill_rule, Paths64& closed_paths)
+		{
+			return std::async(std::launch::async, [this, clip_type, fill_rule, &closed_paths]()
+			{
+				return Execute(clip_type, fill_rule, closed_paths);
+			});
+		}
+
+		std::future<bool> ExecuteAsync(ClipType clip_type,
+			FillRule fill_rule, Paths64& closed_paths, Paths64& open_paths)
+		{
+			return std::async(std::launch::async,
+				[this, clip_type, fill_rule, &closed_paths, &open_paths]()
+			{
+				return Execute(clip_type, fill_rule, closed_paths, open_paths);
+			});
+		}
+
 	};
 
 	class ClipperD : public ClipperBase {
@@ -415,6 +773,26 @@ namespace Clipper2Lib {
 			return true;
 		}
 
+		//ExecuteAsync: see Clipper64::ExecuteAsync
+		std::future<bool> ExecuteAsync(ClipType clip_type,
+			FillRule fill_rule, PathsD& closed_paths)
+		{
+			return std::async(std::launch::async, [this, clip_type, fill_rule, &closed_paths]()
+			{
+				return Execute(clip_type, fill_rule, closed_paths);
+			});
+		}
+
+		std::future<bool> ExecuteAsync(ClipType clip_type,
+			FillRule fill_rule, PathsD& closed_paths, PathsD& open_paths)
+		{
+			return std::async(std::launch::async,
+				[this, clip_type, fill_rule, &closed_paths, &open_paths]()
+			{
+				return Execute(clip_type, fill_rule, closed_paths, open_paths);
+			});
+		}
+
 	};
 
 	using Clipper = Clipper64;
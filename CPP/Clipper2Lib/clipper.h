@@ -11,13 +11,19 @@
 #ifndef CLIPPER_H
 #define CLIPPER_H
 
+#include <chrono>
 #include <cstdlib>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "clipper.core.h"
 #include "clipper.engine.h"
 #include "clipper.offset.h"
 #include "clipper.minkowski.h"
+#include "clipper.rectclip.h"
 
 namespace Clipper2Lib 
 {
@@ -34,14 +40,193 @@ namespace Clipper2Lib
       (std::numeric_limits<double>::lowest)(),
       (std::numeric_limits<double>::lowest)());
 
+  static Rect64 Bounds(const Path64& path)
+  {
+    Rect64 rec = MaxInvalidRect64;
+    for (const Point64& pt : path)
+    {
+      if (pt.x < rec.left) rec.left = pt.x;
+      if (pt.x > rec.right) rec.right = pt.x;
+      if (pt.y < rec.top) rec.top = pt.y;
+      if (pt.y > rec.bottom) rec.bottom = pt.y;
+    }
+    if (rec.IsEmpty()) return Rect64();
+    return rec;
+  }
+  
+  static Rect64 Bounds(const Paths64& paths)
+  {
+    Rect64 rec = MaxInvalidRect64;
+    for (const Path64& path : paths)
+      for (const Point64& pt : path)
+      {
+        if (pt.x < rec.left) rec.left = pt.x;
+        if (pt.x > rec.right) rec.right = pt.x;
+        if (pt.y < rec.top) rec.top = pt.y;
+        if (pt.y > rec.bottom) rec.bottom = pt.y;
+      }
+    if (rec.IsEmpty()) return Rect64();
+    return rec;
+  }
+
+  static RectD Bounds(const PathD& path)
+  {
+    RectD rec = MaxInvalidRectD;
+    for (const PointD& pt : path)
+    {
+      if (pt.x < rec.left) rec.left = pt.x;
+      if (pt.x > rec.right) rec.right = pt.x;
+      if (pt.y < rec.top) rec.top = pt.y;
+      if (pt.y > rec.bottom) rec.bottom = pt.y;
+    }
+    if (rec.IsEmpty()) return RectD();
+    return rec;
+  }
+
+  static RectD Bounds(const PathsD& paths)
+  {
+    RectD rec = MaxInvalidRectD;
+    for (const PathD& path : paths)
+      for (const PointD& pt : path)
+      {
+        if (pt.x < rec.left) rec.left = pt.x;
+        if (pt.x > rec.right) rec.right = pt.x;
+        if (pt.y < rec.top) rec.top = pt.y;
+        if (pt.y > rec.bottom) rec.bottom = pt.y;
+      }
+    if (rec.IsEmpty()) return RectD();
+    return rec;
+  }
+
+  namespace details
+  {
+
+    //The simple functions below (BooleanOp, Intersect, Union etc) each use a
+    //per-thread clipping engine that's reused across calls. These engines
+    //retain their memory (see ClipperBase::ReuseMemory) so that, once warmed
+    //up, repeated operations will only allocate memory for their solutions.
+    //But they retain no more than ThreadClipperMemoryLimit bytes per arena, so
+    //threads don't keep the peak memory of their largest ever operation.
+
+    static const size_t ThreadClipperMemoryLimit = size_t(16) << 20;
+
+    template <typename T>
+    inline T& GetThreadClipper()
+    {
+      thread_local T clipper;
+      clipper.ReuseMemory = true;
+      clipper.ReuseMemoryLimit = ThreadClipperMemoryLimit;
+      clipper.Clear();
+      return clipper;
+    }
+
+    inline Rect64 ScaleRect(const RectD& rect, double scale)
+    {
+      return Rect64(
+        static_cast<int64_t>(std::round(rect.left * scale)),
+        static_cast<int64_t>(std::round(rect.top * scale)),
+        static_cast<int64_t>(std::round(rect.right * scale)),
+        static_cast<int64_t>(std::round(rect.bottom * scale)));
+    }
+
+    inline void RemoveInsetCollapses(Paths64& paths, double step)
+    {
+      //outer paths that can't contain a circle with radius 'step' (because
+      //their bounds are too narrow or their areas are too small) will vanish
+      //when inset by step. Holes expand instead, but are removed when there
+      //are no outer paths left. (The path with the largest absolute area is
+      //always an outer path, and so indicates outer path orientation.)
+      std::vector<double> areas;
+      areas.reserve(paths.size());
+      double max_area = 0;
+      for (const Path64& path : paths)
+      {
+        areas.push_back(Area(path));
+        if (std::abs(areas.back()) > std::abs(max_area)) max_area = areas.back();
+      }
+      const double min_area = PI * step * step;
+      bool has_outer = false;
+      size_t cnt = 0;
+      for (size_t i = 0; i < paths.size(); ++i)
+      {
+        const bool is_outer = (areas[i] > 0) == (max_area > 0);
+        if (is_outer)
+        {
+          const Rect64 rec = Bounds(paths[i]);
+          if (std::abs(areas[i]) < min_area ||
+            rec.Width() <= 2 * step || rec.Height() <= 2 * step) continue;
+          has_outer = true;
+        }
+        if (i != cnt) paths[cnt] = std::move(paths[i]);
+        ++cnt;
+      }
+      paths.resize(has_outer ? cnt : 0);
+    }
+
+    template <typename T>
+    inline bool AreSeparate(const Rect<T>& rec1, const Rect<T>& rec2)
+    {
+      return rec1.IsEmpty() || rec2.IsEmpty() ||
+        rec1.right < rec2.left || rec2.right < rec1.left ||
+        rec1.bottom < rec2.top || rec2.bottom < rec1.top;
+    }
+
+    template <typename T>
+    inline const Paths<T>& CullPaths(const Paths<T>& paths,
+      const Rect<T>& rec, Paths<T>& culled_paths)
+    {
+      //returns 'paths' unless some are separated from rec, in which case
+      //the remaining paths are copied into, and returned as, culled_paths
+      size_t i = 0;
+      while (i < paths.size() && !AreSeparate(Bounds(paths[i]), rec)) ++i;
+      if (i == paths.size()) return paths;
+      culled_paths.assign(paths.begin(), paths.begin() + i);
+      for (++i; i < paths.size(); ++i)
+        if (!AreSeparate(Bounds(paths[i]), rec)) culled_paths.push_back(paths[i]);
+      return culled_paths;
+    }
+
+    template <typename T, typename TClipper>
+    inline void AddCulledPaths(TClipper& clipper, ClipType cliptype,
+      const Paths<T>& subjects, const Paths<T>& clips)
+    {
+      //paths that are separated from the other operand's bounds can't
+      //contribute to intersections, and clips that are separated from
+      //subjects won't change differences, so these needn't be added
+      if (cliptype != ClipType::Intersection && cliptype != ClipType::Difference)
+      {
+        clipper.AddSubject(subjects);
+        clipper.AddClip(clips);
+        return;
+      }
+      Paths<T> culled_subjects, culled_clips;
+      const Paths<T>& clips2 = CullPaths(clips, Bounds(subjects), culled_clips);
+      if (clips2.empty())
+      {
+        if (cliptype == ClipType::Difference) clipper.AddSubject(subjects);
+      }
+      else if (cliptype == ClipType::Intersection)
+      {
+        clipper.AddSubject(CullPaths(subjects, Bounds(clips2), culled_subjects));
+        clipper.AddClip(clips2);
+      }
+      else
+      {
+        clipper.AddSubject(subjects);
+        clipper.AddClip(clips2);
+      }
+    }
+
+  } //end details namespace
+
   inline Paths64 BooleanOp(ClipType cliptype, FillRule fillrule,
     const Paths64& subjects, const Paths64& clips)
   {
     Paths64 result;
-    Clipper64 clipper;
-    clipper.AddSubject(subjects);
-    clipper.AddClip(clips);
+    Clipper64& clipper = details::GetThreadClipper<Clipper64>();
+    details::AddCulledPaths(clipper, cliptype, subjects, clips);
     clipper.Execute(cliptype, fillrule, result);
+    clipper.Clear();
     return result;
   }
 
@@ -49,13 +234,61 @@ namespace Clipper2Lib
     const PathsD& subjects, const PathsD& clips)
   {
     PathsD result;
-    ClipperD clipper;
-    clipper.AddSubject(subjects);
-    clipper.AddClip(clips);
+    ClipperD& clipper = details::GetThreadClipper<ClipperD>();
+    details::AddCulledPaths(clipper, cliptype, subjects, clips);
     clipper.Execute(cliptype, fillrule, result);
+    clipper.Clear();
     return result;
   }
 
+  //BooleanJob & BooleanJobResult: see BooleanOpBatch
+  template <typename T>
+  struct BooleanJob {
+    ClipType cliptype = ClipType::None;
+    FillRule fillrule = FillRule::NonZero;
+    Paths<T> subjects;
+    Paths<T> clips;
+  };
+
+  template <typename T>
+  struct BooleanJobResult {
+    Paths<T> solution;
+    bool succeeded = false;
+    std::chrono::steady_clock::duration elapsed{};  //the job's execution time
+  };
+
+  using BooleanJob64 = BooleanJob<int64_t>;
+  using BooleanJobD = BooleanJob<double>;
+  using BooleanJobResult64 = BooleanJobResult<int64_t>;
+  using BooleanJobResultD = BooleanJobResult<double>;
+
+  //BooleanOpBatch: performs many independent boolean operations, returning
+  //their results in the same order as jobs. When thread_count > 1, jobs are
+  //handed out one at a time to that many threads (see ParallelFor) so uneven
+  //jobs are balanced, and each thread reuses its own clipping engine (see
+  //GetThreadClipper) for all the jobs it performs.
+  template <typename T>
+  inline std::vector<BooleanJobResult<T>> BooleanOpBatch(
+    const std::vector<BooleanJob<T>>& jobs, unsigned thread_count = 1)
+  {
+    typedef typename std::conditional<std::is_integral<T>::value,
+      Clipper64, ClipperD>::type TClipper;
+    std::vector<BooleanJobResult<T>> results(jobs.size());
+    ParallelFor(jobs.size(), thread_count, [&](size_t i)
+    {
+      const BooleanJob<T>& job = jobs[i];
+      BooleanJobResult<T>& result = results[i];
+      const std::chrono::steady_clock::time_point started =
+        std::chrono::steady_clock::now();
+      TClipper& clipper = details::GetThreadClipper<TClipper>();
+      details::AddCulledPaths(clipper, job.cliptype, job.subjects, job.clips);
+      result.succeeded = clipper.Execute(job.cliptype, job.fillrule, result.solution);
+      clipper.Clear();
+      result.elapsed = std::chrono::steady_clock::now() - started;
+    });
+    return results;
+  }
+
   inline Paths64 Intersect(const Paths64& subjects, const Paths64& clips, FillRule fillrule)
   {
     return BooleanOp(ClipType::Intersection, fillrule, subjects, clips);
@@ -79,18 +312,20 @@ namespace Clipper2Lib
   inline Paths64 Union(const Paths64& subjects, FillRule fillrule)
   {
     Paths64 result;
-    Clipper64 clipper;
+    Clipper64& clipper = details::GetThreadClipper<Clipper64>();
     clipper.AddSubject(subjects);
     clipper.Execute(ClipType::Union, fillrule, result);
+    clipper.Clear();
     return result;
   }
 
   inline PathsD Union(const PathsD& subjects, FillRule fillrule)
   {
     PathsD result;
-    ClipperD clipper;
+    ClipperD& clipper = details::GetThreadClipper<ClipperD>();
     clipper.AddSubject(subjects);
     clipper.Execute(ClipType::Union, fillrule, result);
+    clipper.Clear();
     return result;
   }
 
@@ -114,6 +349,65 @@ namespace Clipper2Lib
     return BooleanOp(ClipType::Xor, fillrule, subjects, clips);
   }
 
+  //RectClip: much faster than Intersect when clipping closed paths to a
+  //rectangle, but solutions may still contain self-intersections and
+  //overlapping paths (see RectClip64)
+  inline Paths64 RectClip(const Rect64& rect, const Paths64& paths)
+  {
+    if (rect.IsEmpty() || paths.empty()) return Paths64();
+    RectClip64 rc(rect);
+    return rc.Execute(paths);
+  }
+
+  inline PathsD RectClip(const RectD& rect, const PathsD& paths, int precision = 2)
+  {
+    if (rect.IsEmpty() || paths.empty()) return PathsD();
+    if (precision < -8 || precision > 8)
+      throw new Clipper2Exception("Error: Precision exceeds the allowed range.");
+    const double scale = std::pow(10, precision);
+    RectClip64 rc(details::ScaleRect(rect, scale));
+    Paths64 result = rc.Execute(ScalePaths<int64_t, double>(paths, scale));
+    return ScalePaths<double, int64_t>(result, 1 / scale);
+  }
+
+  //RectClipLines: clips open paths to a rectangle (much faster than
+  //clipping open paths with Clipper64 and a rectangular clip)
+  inline Paths64 RectClipLines(const Rect64& rect, const Paths64& lines)
+  {
+    if (rect.IsEmpty() || lines.empty()) return Paths64();
+    RectClipLines64 rcl(rect);
+    return rcl.Execute(lines);
+  }
+
+  inline PathsD RectClipLines(const RectD& rect, const PathsD& lines, int precision = 2)
+  {
+    if (rect.IsEmpty() || lines.empty()) return PathsD();
+    if (precision < -8 || precision > 8)
+      throw new Clipper2Exception("Error: Precision exceeds the allowed range.");
+    const double scale = std::pow(10, precision);
+    RectClipLines64 rcl(details::ScaleRect(rect, scale));
+    Paths64 result = rcl.Execute(ScalePaths<int64_t, double>(lines, scale));
+    return ScalePaths<double, int64_t>(result, 1 / scale);
+  }
+
+  //RectClipTiles: equivalent to calling RectClip for every tile in grid, but
+  //paths are only visited for the tiles they overlap (see RectClipTiles64).
+  //Solutions are in row-major order, ie tile (row, col) is at index
+  //row * grid.cols + col.
+  inline std::vector<Paths64> RectClipTiles(const TileGrid& grid,
+    const Paths64& paths, unsigned thread_count = 1)
+  {
+    RectClipTiles64 rct(grid);
+    return rct.Execute(paths, thread_count);
+  }
+
+  inline std::vector<Paths64> RectClipLinesTiles(const TileGrid& grid,
+    const Paths64& lines, unsigned thread_count = 1)
+  {
+    RectClipTiles64 rct(grid);
+    return rct.ExecuteLines(lines, thread_count);
+  }
+
   static bool IsFullOpenEndType(EndType et)
   {
     return (et != EndType::Polygon) && (et != EndType::Joined);
@@ -139,6 +433,48 @@ namespace Clipper2Lib
     return ScalePaths<double, int64_t>(tmp, 1 / scale);
   }
 
+  //InsetPaths: repeatedly insets closed paths by step, with each inset being
+  //of the previous inset, until nothing remains (or max_levels is reached),
+  //eg for pocketing toolpaths. Each level (starting at 1) is passed to
+  //callback, which can return false to stop early, and only the current level
+  //is held in memory. Paths are dropped as soon as they're too small to
+  //survive the next inset. Returns the number of levels passed to callback.
+  static size_t InsetPaths(const Paths64& paths, double step, JoinType jt,
+    const std::function<bool(size_t, const Paths64&)>& callback,
+    double miter_limit = 2.0, size_t max_levels = 0)
+  {
+    step = std::abs(step);
+    if (step < 1) return 0;  //nb: tiny offsets don't change paths
+    ClipperOffset clip_offset(miter_limit);
+    clip_offset.AddPaths(paths, jt, EndType::Polygon);
+    Paths64 level_paths = clip_offset.Execute(-step);
+    size_t level = 0;
+    while (!level_paths.empty())
+    {
+      if (!callback(++level, level_paths) || level == max_levels) break;
+      details::RemoveInsetCollapses(level_paths, step);
+      if (level_paths.empty()) break;
+      clip_offset.Clear();
+      clip_offset.AddPaths(std::move(level_paths), jt, EndType::Polygon);
+      level_paths = clip_offset.Execute(-step);
+    }
+    return level;
+  }
+
+  static size_t InsetPaths(const PathsD& paths, double step, JoinType jt,
+    const std::function<bool(size_t, const PathsD&)>& callback,
+    double miter_limit = 2.0, size_t max_levels = 0, double precision = 2)
+  {
+    if (precision < -8 || precision > 8)
+      throw new Clipper2Exception("Error: Precision exceeds the allowed range.");
+    const double scale = std::pow(10, precision);
+    return InsetPaths(ScalePaths<int64_t, double>(paths, scale), step * scale, jt,
+      [&](size_t level, const Paths64& level_paths)
+      {
+        return callback(level, ScalePaths<double, int64_t>(level_paths, 1 / scale));
+      }, miter_limit, max_levels);
+  }
+
   inline Path64 OffsetPath(const Path64& path, int64_t dx, int64_t dy)
   {
     Path64 result;
@@ -175,62 +511,195 @@ namespace Clipper2Lib
     return result;
   }
 
-  static Rect64 Bounds(const Path64& path)
+  namespace details
   {
-    Rect64 rec = MaxInvalidRect64;
-    for (const Point64& pt : path)
+
+    static const size_t UnionManyGroupSize = 64;
+
+    inline uint64_t SpreadBits(uint32_t value)
     {
-      if (pt.x < rec.left) rec.left = pt.x;
-      if (pt.x > rec.right) rec.right = pt.x;
-      if (pt.y < rec.top) rec.top = pt.y;
-      if (pt.y > rec.bottom) rec.bottom = pt.y;
+      uint64_t result = value;
+      result = (result | (result << 16)) & 0x0000FFFF0000FFFF;
+      result = (result | (result << 8)) & 0x00FF00FF00FF00FF;
+      result = (result | (result << 4)) & 0x0F0F0F0F0F0F0F0F;
+      result = (result | (result << 2)) & 0x3333333333333333;
+      result = (result | (result << 1)) & 0x5555555555555555;
+      return result;
     }
-    if (rec.IsEmpty()) return Rect64();
-    return rec;
-  }
-  
-  static Rect64 Bounds(const Paths64& paths)
-  {
-    Rect64 rec = MaxInvalidRect64;
-    for (const Path64& path : paths)
-      for (const Point64& pt : path)
+
+    inline uint64_t GetMortonCode(uint32_t x, uint32_t y)
+    {
+      return SpreadBits(x) | (SpreadBits(y) << 1);
+    }
+
+    inline void SplitOverlapping(Paths64& paths1, Paths64& paths2,
+      Paths64& separate, Paths64& overlapping)
+    {
+      //moves paths whose bounds overlap those of any path in the other
+      //group into 'overlapping', and moves all other paths into 'separate'
+      struct PathBounds {
+        Rect64 rec;
+        Path64* path;
+        bool is_group1;
+        bool is_overlapping;
+      };
+      std::vector<PathBounds> path_bounds;
+      path_bounds.reserve(paths1.size() + paths2.size());
+      for (Path64& path : paths1)
+        path_bounds.push_back(PathBounds{ Bounds(path), &path, true, false });
+      for (Path64& path : paths2)
+        path_bounds.push_back(PathBounds{ Bounds(path), &path, false, false });
+      std::sort(path_bounds.begin(), path_bounds.end(),
+        [](const PathBounds& a, const PathBounds& b) { return a.rec.left < b.rec.left; });
+
+      //sweep left to right, keeping a list of the bounds that span the sweep
+      std::vector<PathBounds*> spanning;
+      for (PathBounds& pb : path_bounds)
       {
-        if (pt.x < rec.left) rec.left = pt.x;
-        if (pt.x > rec.right) rec.right = pt.x;
-        if (pt.y < rec.top) rec.top = pt.y;
-        if (pt.y > rec.bottom) rec.bottom = pt.y;
+        size_t cnt = 0;
+        for (PathBounds* pb2 : spanning)
+        {
+          if (pb2->rec.right < pb.rec.left) continue;
+          spanning[cnt++] = pb2;
+          if (pb2->is_group1 != pb.is_group1 && 
+            pb2->rec.top <= pb.rec.bottom && pb.rec.top <= pb2->rec.bottom)
+              pb.is_overlapping = pb2->is_overlapping = true;
+        }
+        spanning.resize(cnt);
+        spanning.push_back(&pb);
       }
-    if (rec.IsEmpty()) return Rect64();
-    return rec;
-  }
 
-  static RectD Bounds(const PathD& path)
+      for (PathBounds& pb : path_bounds)
+        if (pb.is_overlapping)
+          overlapping.push_back(std::move(*pb.path));
+        else
+          separate.push_back(std::move(*pb.path));
+    }
+
+  } //end details namespace
+
+  //UnionMany: returns the same solution as Union(subjects, fillrule) but is
+  //much faster (and uses much less memory) when there are very many small
+  //polygons. Paths are grouped by proximity (using the Morton order of their
+  //bounds' centres) and each group is unioned separately, then neighbouring
+  //group solutions are merged pairwise until only one solution remains. When
+  //thread_count > 1, groups (and merges) are processed concurrently. Since
+  //groups are unioned separately, each path must be a separate polygon (ie
+  //holes can't be defined by other paths), and with the NonZero, Positive and
+  //Negative fill rules, paths should all have the same orientation. (With
+  //EvenOdd, neither restriction applies.)
+  inline Paths64 UnionMany(const Paths64& subjects,
+    FillRule fillrule, unsigned thread_count = 1)
   {
-    RectD rec = MaxInvalidRectD;
-    for (const PointD& pt : path)
+    if (subjects.size() <= details::UnionManyGroupSize)
+      return Union(subjects, fillrule);
+
+    //sort paths by the Morton codes of their bounds' centres
+    const Rect64 rec = Bounds(subjects);
+    const double max_code = static_cast<double>((std::numeric_limits<uint32_t>::max)());
+    const double scale_x = (rec.Width() > 0) ? max_code / rec.Width() : 0;
+    const double scale_y = (rec.Height() > 0) ? max_code / rec.Height() : 0;
+    std::vector<std::pair<uint64_t, size_t>> path_codes;
+    path_codes.reserve(subjects.size());
+    for (size_t i = 0; i < subjects.size(); ++i)
     {
-      if (pt.x < rec.left) rec.left = pt.x;
-      if (pt.x > rec.right) rec.right = pt.x;
-      if (pt.y < rec.top) rec.top = pt.y;
-      if (pt.y > rec.bottom) rec.bottom = pt.y;
+      const Rect64 path_rec = Bounds(subjects[i]);
+      const double x = (static_cast<double>(path_rec.left - rec.left) + 
+        static_cast<double>(path_rec.right - rec.left)) * 0.5 * scale_x;
+      const double y = (static_cast<double>(path_rec.top - rec.top) + 
+        static_cast<double>(path_rec.bottom - rec.top)) * 0.5 * scale_y;
+      path_codes.push_back(std::make_pair(details::GetMortonCode(
+        static_cast<uint32_t>(std::max(0.0, std::min(x, max_code))),
+        static_cast<uint32_t>(std::max(0.0, std::min(y, max_code)))), i));
     }
-    if (rec.IsEmpty()) return RectD();
-    return rec;
-  }
+    std::sort(path_codes.begin(), path_codes.end());
+
+    //union each group of neighbouring paths
+    const size_t group_size = details::UnionManyGroupSize;
+    const size_t group_cnt = (path_codes.size() + group_size - 1) / group_size;
+    std::vector<Paths64> solutions(group_cnt);
+    std::vector<Rect64> solution_bounds(group_cnt);
+    ParallelFor(group_cnt, thread_count, [&](size_t group_idx)
+    {
+      const size_t first = group_idx * group_size;
+      const size_t last = std::min(first + group_size, path_codes.size());
+      Paths64 group;
+      group.reserve(last - first);
+      for (size_t i = first; i < last; ++i)
+        group.push_back(subjects[path_codes[i].second]);
+      solutions[group_idx] = Union(group, fillrule);
+      solution_bounds[group_idx] = Bounds(solutions[group_idx]);
+    });
+
+    //then merge neighbouring solutions pairwise until just one remains
+    //(nb: solutions using the Negative fill rule have reversed orientation,
+    //and with EvenOdd, regions covered by both solutions must be removed)
+    const FillRule merge_fillrule = (fillrule == FillRule::Negative ||
+      fillrule == FillRule::EvenOdd) ? fillrule : FillRule::NonZero;
+    while (solutions.size() > 1)
+    {
+      const size_t merge_cnt = solutions.size() / 2;
+      ParallelFor(merge_cnt, thread_count, [&](size_t i)
+      {
+        Paths64& paths1 = solutions[i * 2];
+        Paths64& paths2 = solutions[i * 2 + 1];
+        Rect64& rec1 = solution_bounds[i * 2];
+        const Rect64& rec2 = solution_bounds[i * 2 + 1];
+        if (paths2.empty()) return;
+        if (paths1.empty())
+        {
+          paths1 = std::move(paths2);
+          rec1 = rec2;
+        }
+        else if (details::AreSeparate(rec1, rec2))
+        {
+          paths1.insert(paths1.end(), std::make_move_iterator(paths2.begin()),
+            std::make_move_iterator(paths2.end()));
+          rec1 = Rect64(std::min(rec1.left, rec2.left), std::min(rec1.top, rec2.top),
+            std::max(rec1.right, rec2.right), std::max(rec1.bottom, rec2.bottom));
+        }
+        else
+        {
+          //only paths overlapping paths in the other solution can change
+          const Rect64 merged_rec = Rect64(std::min(rec1.left, rec2.left),
+            std::min(rec1.top, rec2.top), std::max(rec1.right, rec2.right),
+            std::max(rec1.bottom, rec2.bottom));
+          Paths64 merged, overlapping;
+          details::SplitOverlapping(paths1, paths2, merged, overlapping);
+          overlapping = Union(overlapping, merge_fillrule);
+          merged.insert(merged.end(), std::make_move_iterator(overlapping.begin()),
+            std::make_move_iterator(overlapping.end()));
+          paths1 = std::move(merged);
+          rec1 = merged_rec;
+        }
+      });
 
-  static RectD Bounds(const PathsD& paths)
-  {
-    RectD rec = MaxInvalidRectD;
-    for (const PathD& path : paths)
-      for (const PointD& pt : path)
+      for (size_t i = 1; i < merge_cnt; ++i)
       {
-        if (pt.x < rec.left) rec.left = pt.x;
-        if (pt.x > rec.right) rec.right = pt.x;
-        if (pt.y < rec.top) rec.top = pt.y;
-        if (pt.y > rec.bottom) rec.bottom = pt.y;
+        solutions[i] = std::move(solutions[i * 2]);
+        solution_bounds[i] = solution_bounds[i * 2];
       }
-    if (rec.IsEmpty()) return RectD();
-    return rec;
+      if (solutions.size() % 2)
+      {
+        solutions[merge_cnt] = std::move(solutions.back());
+        solution_bounds[merge_cnt] = solution_bounds.back();
+        solutions.resize(merge_cnt + 1);
+        solution_bounds.resize(merge_cnt + 1);
+      }
+      else
+      {
+        solutions.resize(merge_cnt);
+        solution_bounds.resize(merge_cnt);
+      }
+    }
+    return std::move(solutions[0]);
+  }
+
+  inline PathsD UnionMany(const PathsD& subjects,
+    FillRule fillrule, unsigned thread_count = 1)
+  {
+    return ScalePaths<double, int64_t>(UnionMany(
+      ScalePaths<int64_t, double>(subjects, 1), fillrule, thread_count), 1);
   }
 
   namespace details 
@@ -9,6 +9,7 @@
 *******************************************************************************/
 
 #include <cmath>
+#include <iterator>
 #include "clipper.offset.h"
 #include "clipper.engine.h"
 
@@ -54,6 +55,140 @@ inline bool IsClosedPath(EndType et)
 	return et == EndType::Polygon || et == EndType::Joined;
 }
 
+int GetConvexity(const Path64& path)
+{
+	//returns the sign of the path's area when the path is convex, otherwise 0.
+	//(Collinear vertices are allowed but spikes aren't. And because paths that
+	//only ever turn one way can still loop more than once, the direction of
+	//edges must also reverse no more than twice on each axis.)
+	const size_t cnt = path.size();
+	if (cnt < 3) return 0;
+	int turn = 0, first_dx = 0, last_dx = 0, first_dy = 0, last_dy = 0;
+	size_t dx_reversals = 0, dy_reversals = 0;
+	auto update_reversals = [](int64_t d, int& first, int& last, size_t& reversals)
+	{
+		if (d == 0) return;
+		const int sign = d > 0 ? 1 : -1;
+		if (!first) first = sign;
+		else if (sign != last) ++reversals;
+		last = sign;
+	};
+
+	for (size_t i = 0, j = cnt - 1; i < cnt; j = i, ++i)
+	{
+		const Point64& pt1 = path[j], pt2 = path[i], pt3 = path[(i + 1) % cnt];
+		const double cross = CrossProduct(pt1, pt2, pt3);
+		if (cross == 0)
+		{
+			if (DotProduct(pt1, pt2, pt3) <= 0) return 0;
+		}
+		else if (!turn)
+			turn = cross > 0 ? 1 : -1;
+		else if ((cross > 0) != (turn > 0))
+			return 0;
+		update_reversals(pt3.x - pt2.x, first_dx, last_dx, dx_reversals);
+		update_reversals(pt3.y - pt2.y, first_dy, last_dy, dy_reversals);
+	}
+	if (last_dx != first_dx) ++dx_reversals;
+	if (last_dy != first_dy) ++dy_reversals;
+	if (!turn || dx_reversals > 2 || dy_reversals > 2) return 0;
+	return Area(path) > 0 ? 1 : -1;
+}
+
+bool HaveOverlappingBounds(const Paths64& paths)
+{
+	//returns true when the bounds of any two paths overlap (or touch)
+	std::vector<Rect64> recs;
+	recs.reserve(paths.size());
+	for (const Path64& path : paths)
+	{
+		Rect64 rec(std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::max(),
+			std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::min());
+		for (const Point64& pt : path)
+		{
+			if (pt.x < rec.left) rec.left = pt.x;
+			if (pt.x > rec.right) rec.right = pt.x;
+			if (pt.y < rec.top) rec.top = pt.y;
+			if (pt.y > rec.bottom) rec.bottom = pt.y;
+		}
+		recs.push_back(rec);
+	}
+	std::sort(recs.begin(), recs.end(),
+		[](const Rect64& a, const Rect64& b) { return a.left < b.left; });
+	for (size_t i = 0; i < recs.size(); ++i)
+		for (size_t j = i + 1; j < recs.size() && recs[j].left <= recs[i].right; ++j)
+			if (recs[j].top <= recs[i].bottom && recs[i].top <= recs[j].bottom)
+				return true;
+	return false;
+}
+
+bool IsConvexOffset(const PathGroup& group, double delta)
+{
+	//returns true when every path in the group is convex and is expanded by
+	//delta, since every offset path will then also be convex (and so can't
+	//self-intersect). But with deltas less than 1, rounding offset vertices to
+	//integers can fold paths back over themselves, so those are still cleaned up
+	if (group.end_type != EndType::Polygon || std::abs(delta) < 1) return false;
+	if (group.is_reversed) delta = -delta;
+	const int expanding = delta > 0 ? 1 : -1;
+	for (int convexity : group.convexity_)
+		if (convexity != expanding) return false;
+	return true;
+}
+
+void TidyConvexOffset(Paths64& paths, bool is_reversed, bool preserve_collinear)
+{
+	//when the cleanup union is skipped, paths are still returned as the union
+	//would return them: without duplicate vertices or spikes (which rounding to
+	//integers can create, especially with small deltas), without collinear
+	//vertices (unless preserve_collinear), and with the orientation of the
+	//union's solutions (see the fill rules used in DoGroupOffset). And tiny
+	//paths whose orientation has been inverted by rounding are removed too
+	Paths64::size_type cnt = 0;
+	for (Path64& path : paths)
+	{
+		path = StripDuplicates(path, true);
+		bool is_changed = true;
+		while (is_changed && path.size() > 2)
+		{
+			is_changed = false;
+			Path64 result;
+			result.reserve(path.size());
+			for (size_t i = 0; i < path.size(); ++i)
+			{
+				const Point64& prev = result.empty() ? path.back() : result.back();
+				const Point64& pt = path[i], & next = path[(i + 1) % path.size()];
+				if (pt == prev || pt == next || (CrossProduct(prev, pt, next) == 0 &&
+					(!preserve_collinear || DotProduct(prev, pt, next) <= 0)))
+					is_changed = true;
+				else
+					result.push_back(pt);
+			}
+			path.swap(result);
+		}
+		if (path.size() < 3) continue;
+		const double area = Area(path);
+		if (area == 0 || (area < 0) != is_reversed) continue;
+#ifndef REVERSE_ORIENTATION
+		std::reverse(path.begin(), path.end());
+#endif
+		if (&path != &paths[cnt]) paths[cnt] = std::move(path);
+		++cnt;
+	}
+	paths.resize(cnt);
+}
+
+void BuildNormals(const Path64& path, PathD& norms)
+{
+	norms.clear();
+	norms.reserve(path.size());
+	if (path.size() == 0) return;
+	Path64::const_iterator path_iter, path_last_iter = --path.cend();
+	for (path_iter = path.cbegin(); path_iter != path_last_iter; ++path_iter)
+		norms.push_back(GetUnitNormal(*path_iter,*(path_iter +1)));
+	norms.push_back(GetUnitNormal(*path_last_iter, *(path.cbegin())));
+}
+
 //------------------------------------------------------------------------------
 // ClipperOffset methods
 //------------------------------------------------------------------------------
@@ -71,6 +206,12 @@ void ClipperOffset::AddPaths(const Paths64 &paths, JoinType jt_, EndType et_)
 	groups_.push_back(PathGroup(paths, jt_, et_));
 }
 
+void ClipperOffset::AddPaths(Paths64&& paths, JoinType jt_, EndType et_)
+{
+	if (paths.size() == 0) return;
+	groups_.push_back(PathGroup(std::move(paths), jt_, et_));
+}
+
 void ClipperOffset::AddPath(const Clipper2Lib::PathD& path, JoinType jt_, EndType et_)
 {
 	PathsD paths;
@@ -84,217 +225,237 @@ void ClipperOffset::AddPaths(const PathsD& paths, JoinType jt_, EndType et_)
 	groups_.push_back(PathGroup(PathsDToPaths64(paths), jt_, et_));
 }
 
-void ClipperOffset::BuildNormals(const Path64& path)
-{
-	norms.clear();
-	norms.reserve(path.size());
-	if (path.size() == 0) return;
-	Path64::const_iterator path_iter, path_last_iter = --path.cend();
-	for (path_iter = path.cbegin(); path_iter != path_last_iter; ++path_iter)
-		norms.push_back(GetUnitNormal(*path_iter,*(path_iter +1)));
-	norms.push_back(GetUnitNormal(*path_last_iter, *(path.cbegin())));
-}
-
-void ClipperOffset::DoSquare(PathGroup& group, const Path64& path, size_t j, size_t k)
+void ClipperOffset::DoSquare(OffsetState& state, const Path64& path, size_t j, size_t k)
 {
-	if (delta_ > 0)
+	if (state.delta > 0)
 	{
-		group.path_.push_back(Point64(
-			path[j].x + delta_ * (norms[k].x - norms[k].y),
-			path[j].y + delta_ * (norms[k].y + norms[k].x)));
-		group.path_.push_back(Point64(
-			path[j].x + delta_ * (norms[j].x + norms[j].y),
-			path[j].y + delta_ * (norms[j].y - norms[j].x)));
+		state.path.push_back(Point64(
+			path[j].x + state.delta * (state.norms[k].x - state.norms[k].y),
+			path[j].y + state.delta * (state.norms[k].y + state.norms[k].x)));
+		state.path.push_back(Point64(
+			path[j].x + state.delta * (state.norms[j].x + state.norms[j].y),
+			path[j].y + state.delta * (state.norms[j].y - state.norms[j].x)));
 	}
 	else
 	{
-		group.path_.push_back(Point64(
-			path[j].x + delta_ * (norms[k].x + norms[k].y),
-			path[j].y + delta_ * (norms[k].y - norms[k].x)));
-		group.path_.push_back(Point64(
-			path[j].x + delta_ * (norms[j].x - norms[j].y),
-			path[j].y + delta_ * (norms[j].y + norms[j].x)));
+		state.path.push_back(Point64(
+			path[j].x + state.delta * (state.norms[k].x + state.norms[k].y),
+			path[j].y + state.delta * (state.norms[k].y - state.norms[k].x)));
+		state.path.push_back(Point64(
+			path[j].x + state.delta * (state.norms[j].x - state.norms[j].y),
+			path[j].y + state.delta * (state.norms[j].y + state.norms[j].x)));
 	}
 }
 
-void ClipperOffset::DoMiter(PathGroup& group, const Path64& path, size_t j, size_t k, double cos_a)
+void ClipperOffset::DoMiter(OffsetState& state, const Path64& path, size_t j, size_t k, double cos_a)
 {
-	double q = delta_ / (cos_a + 1);
-	group.path_.push_back(Point64(
-		path[j].x + (norms[k].x + norms[j].x) * q,
-		path[j].y + (norms[k].y + norms[j].y) * q));
+	double q = state.delta / (cos_a + 1);
+	state.path.push_back(Point64(
+		path[j].x + (state.norms[k].x + state.norms[j].x) * q,
+		path[j].y + (state.norms[k].y + state.norms[j].y) * q));
 }
 
-void ClipperOffset::DoRound(PathGroup& group, const Point64& pt,
+void ClipperOffset::DoRound(OffsetState& state, const Point64& pt,
 	const PointD& norm1, const PointD& norm2, double angle)
 {
 	//even though angle may be negative this is a convex join
-	PointD pt2 = PointD(norm2.x * delta_, norm2.y * delta_);
-	int steps = static_cast<int>(std::round(steps_per_rad_ * std::abs(angle) + 0.501));
-	group.path_.push_back(Point64(pt.x + pt2.x, pt.y + pt2.y));
-	double step_sin = std::sin(angle / steps);
-	double step_cos = std::cos(angle / steps);
-	for (int i = 0; i < steps; i++)
+	PointD pt2 = PointD(norm2.x * state.delta, norm2.y * state.delta);
+	state.path.push_back(Point64(pt.x + pt2.x, pt.y + pt2.y));
+	//pt2 is rotated by multiples of a fixed step (see step_vecs) until the
+	//rotation reaches angle, with pt1 (below) then completing the join
+	const double steps = state.steps_per_rad * std::abs(angle);
+	const size_t step_cnt = std::min(state.step_vecs.size(),
+		steps > 1 ? static_cast<size_t>(std::ceil(steps)) - 1 : 0);
+	const double sign = angle < 0 ? -1.0 : 1.0;
+	state.path.reserve(state.path.size() + step_cnt + 1);
+	for (size_t i = 0; i < step_cnt; ++i)
 	{
-		pt2 = PointD(pt2.x * step_cos - step_sin * pt2.y,
-			pt2.x * step_sin + pt2.y * step_cos);
-		group.path_.push_back(Point64(pt.x + pt2.x, pt.y + pt2.y));
+		const double step_cos = state.step_vecs[i].x, step_sin = state.step_vecs[i].y * sign;
+		state.path.push_back(Point64(pt.x + pt2.x * step_cos - step_sin * pt2.y,
+			pt.y + pt2.x * step_sin + pt2.y * step_cos));
 	}
-	pt2 = PointD(norm1.x * delta_, norm1.y * delta_);
-	group.path_.push_back(Point64(pt.x + pt2.x, pt.y + pt2.y));
+	pt2 = PointD(norm1.x * state.delta, norm1.y * state.delta);
+	state.path.push_back(Point64(pt.x + pt2.x, pt.y + pt2.y));
 }
 
-void ClipperOffset::OffsetPoint(PathGroup& group, Path64& path, size_t j, size_t& k)
+void ClipperOffset::OffsetPoint(OffsetState& state, const Path64& path, size_t j, size_t& k)
 {
 	//A: angle between adjoining edges (on left side WRT winding direction).
 	//A == 0 deg (or A == 360 deg): collinear edges heading in same direction
 	//A == 180 deg: collinear edges heading in opposite directions (i.e. a 'spike')
 	//sin(A) < 0: convex on left.
 	//cos(A) > 0: angles on both left and right sides > 90 degrees
-	double sin_a = norms[k].x * norms[j].y - norms[j].x * norms[k].y;
+	double sin_a = state.norms[k].x * state.norms[j].y -
+		state.norms[j].x * state.norms[k].y;
 	if (sin_a > 1.0) sin_a = 1.0;
 	else if (sin_a < -1.0) sin_a = -1.0;
 
-	if (sin_a * delta_ < 0) // a concave offset
+	if (sin_a * state.delta < 0) // a concave offset
 	{
 		Point64 p1 = Point64(
-			path[j].x + norms[k].x * delta_,
-			path[j].y + norms[k].y * delta_);
+			path[j].x + state.norms[k].x * state.delta,
+			path[j].y + state.norms[k].y * state.delta);
 		Point64 p2 = Point64(
-			path[j].x + norms[j].x * delta_,
-			path[j].y + norms[j].y * delta_);
-		group.path_.push_back(p1);
+			path[j].x + state.norms[j].x * state.delta,
+			path[j].y + state.norms[j].y * state.delta);
+		state.path.push_back(p1);
 		if (p1 != p2)
 		{
-			group.path_.push_back(path[j]); //this aids with clipping removal later
-			group.path_.push_back(p2);
+			state.path.push_back(path[j]); //this aids with clipping removal later
+			state.path.push_back(p2);
 		}
 	}
 	else
 	{
-		double cos_a = DotProduct(norms[j], norms[k]);
-		switch (join_type_)
+		double cos_a = DotProduct(state.norms[j], state.norms[k]);
+		switch (state.join_type)
 		{
 		case JoinType::Miter:
-			if (1 + cos_a < temp_lim_) DoSquare(group, path, j, k);
-			else DoMiter(group, path, j, k, cos_a);
+			if (1 + cos_a < temp_lim_) DoSquare(state, path, j, k);
+			else DoMiter(state, path, j, k, cos_a);
 			break;
 		case JoinType::Square:
-			if (cos_a >= 0) DoMiter(group, path, j, k, cos_a);
-			else DoSquare(group, path, j, k);
+			if (cos_a >= 0) DoMiter(state, path, j, k, cos_a);
+			else DoSquare(state, path, j, k);
 			break;
 		default:
-			DoRound(group, path[j], norms[j], norms[k], std::atan2(sin_a, cos_a));
+			DoRound(state, path[j], state.norms[j], state.norms[k],
+				std::atan2(sin_a, cos_a));
 			break;
 		}
 	}
 	k = j;
 }
 
-void ClipperOffset::OffsetPolygon(PathGroup& group, Path64& path)
+void ClipperOffset::OffsetPolygon(OffsetState& state, const Path64& path)
 {
-	group.path_.clear();
+	state.path.clear();
 	for (Path64::size_type i = 0, j = path.size() -1; i < path.size(); j = i, ++i)
-		OffsetPoint(group, path, i, j);
-	group.paths_out_.push_back(group.path_);
+		OffsetPoint(state, path, i, j);
+	state.paths_out.push_back(state.path);
 }
 
-void ClipperOffset::OffsetOpenJoined(PathGroup& group, Path64& path)
+void ClipperOffset::OffsetOpenJoined(OffsetState& state, const Path64& path)
 {
-	OffsetPolygon(group, path);
-	std::reverse(path.begin(), path.end());
-	BuildNormals(path);
-	OffsetPolygon(group, path);
+	OffsetPolygon(state, path);
+	Path64 reverse_path(path.crbegin(), path.crend());
+	//the reversed path's normals are the path's normals reversed and negated
+	//(except for the closing edge's normal, which is only negated)
+	std::reverse(state.norms.begin(), state.norms.end() - 1);
+	for (PointD& norm : state.norms) norm = PointD(-norm.x, -norm.y);
+	OffsetPolygon(state, reverse_path);
 }
 
-void ClipperOffset::OffsetOpenPath(PathGroup& group, Path64& path, EndType end_type)
+void ClipperOffset::OffsetOpenPath(OffsetState& state, const Path64& path, EndType end_type)
 {
-	group.path_.clear();
+	state.path.clear();
 	for (Path64::size_type i = 1, j = 0; i < path.size() -1; j = i, ++i)
-		OffsetPoint(group, path, i, j);
-	PathD::size_type j = norms.size() - 1, k = j - 1;
-	norms[j] = PointD(-norms[k].x, -norms[k].y);
+		OffsetPoint(state, path, i, j);
+	PathD::size_type j = state.norms.size() - 1, k = j - 1;
+	state.norms[j] = PointD(-state.norms[k].x, -state.norms[k].y);
 
 	switch (end_type)
 	{
 	case EndType::Butt:
-		group.path_.push_back(Point64(
-			path[j].x + norms[k].x * delta_,
-			path[j].y + norms[k].y * delta_));
-		group.path_.push_back(Point64(
-			path[j].x - norms[k].x * delta_,
-			path[j].y - norms[k].y * delta_));
+		state.path.push_back(Point64(
+			path[j].x + state.norms[k].x * state.delta,
+			path[j].y + state.norms[k].y * state.delta));
+		state.path.push_back(Point64(
+			path[j].x - state.norms[k].x * state.delta,
+			path[j].y - state.norms[k].y * state.delta));
 		break;
 	case EndType::Round:
 #ifdef REVERSE_ORIENTATION
-		DoRound(group, path[j], norms[j], norms[k], PI);
+		DoRound(state, path[j], state.norms[j], state.norms[k], PI);
 #else
-		DoRound(group, path[j], norms[j], norms[k], -PI);
+		DoRound(state, path[j], state.norms[j], state.norms[k], -PI);
 #endif
 		break;
 	default:
-		DoSquare(group, path, j, k);
+		DoSquare(state, path, j, k);
 		break;
 	}
 
 	//reverse normals ...
 	for (size_t i = k; i > 0; i--)
-		norms[i] = PointD(-norms[i - 1].x, -norms[i - 1].y);
-	norms[0] = PointD(-norms[1].x, -norms[1].y);
+		state.norms[i] = PointD(-state.norms[i - 1].x, -state.norms[i - 1].y);
+	state.norms[0] = PointD(-state.norms[1].x, -state.norms[1].y);
 
 	for (size_t i = k; i > 0; i--)
-		OffsetPoint(group, path, i, j);
+		OffsetPoint(state, path, i, j);
 
 	//now cap the start ...
 	switch (end_type)
 	{
 	case EndType::Butt:
-		group.path_.push_back(Point64(
-			path[0].x + norms[1].x * delta_,
-			path[0].y + norms[1].y * delta_));
-		group.path_.push_back(Point64(
-			path[0].x - norms[1].x * delta_,
-			path[0].y - norms[1].y * delta_));
+		state.path.push_back(Point64(
+			path[0].x + state.norms[1].x * state.delta,
+			path[0].y + state.norms[1].y * state.delta));
+		state.path.push_back(Point64(
+			path[0].x - state.norms[1].x * state.delta,
+			path[0].y - state.norms[1].y * state.delta));
 		break;
 	case EndType::Round:
 #ifdef REVERSE_ORIENTATION
-		DoRound(group, path[0], norms[0], norms[1], PI);
+		DoRound(state, path[0], state.norms[0], state.norms[1], PI);
 #else
-		DoRound(group, path[0], norms[0], norms[1], -PI);
+		DoRound(state, path[0], state.norms[0], state.norms[1], -PI);
 #endif
 		break;
 	default:
-		DoSquare(group, path, 0, 1);
+		DoSquare(state, path, 0, 1);
 		break;
 	}
 
-	group.paths_out_.push_back(group.path_);
+	state.paths_out.push_back(state.path);
 }
 
-void ClipperOffset::DoGroupOffset(PathGroup& group, double delta)
+void ClipperOffset::PrepareGroup(PathGroup& group)
 {
-	if (group.end_type != EndType::Polygon) delta = std::abs(delta) / 2;
-	bool isClosedPaths = IsClosedPath(group.end_type);
+	if (group.is_prepared_) return;
+	group.is_prepared_ = true;
+	bool is_closed_path = IsClosedPath(group.end_type);
 
-	if (isClosedPaths)
+	if (is_closed_path)
 	{
-		group.is_reversed = false;
 		//the lowermost polygon must be an outer polygon. So we can use that as the
 		//designated orientation for outer polygons (needed for tidy-up clipping)
 		Paths64::size_type lowestIdx = GetLowestPolygonIdx(group.paths_in_);
-		if (Area(group.paths_in_[lowestIdx]) == 0) 
-			return;
-		else if (Area(group.paths_in_[lowestIdx]) < 0)
-		{
-			//this is more efficient than literally reversing paths
-			group.is_reversed = true;
-			delta = -delta;
-		}
+		double area = Area(group.paths_in_[lowestIdx]);
+		if (area == 0) return;
+		//this is more efficient than literally reversing paths
+		group.is_reversed = area < 0;
 	}
 
-	delta_ = delta;
-	double absDelta = std::abs(delta_);
-	join_type_ = group.join_type;
+	group.paths_.reserve(group.paths_in_.size());
+	group.norms_.reserve(group.paths_in_.size());
+	Paths64::const_iterator path_iter;
+	for(path_iter = group.paths_in_.cbegin(); path_iter != group.paths_in_.cend(); ++path_iter)
+	{
+		Path64 path = StripDuplicates(*path_iter, is_closed_path);
+		if (path.size() == 0) continue;
+		PathD norms;
+		if (path.size() > 1) BuildNormals(path, norms);
+		if (group.end_type == EndType::Polygon)
+			group.convexity_.push_back(GetConvexity(path));
+		group.paths_.push_back(std::move(path));
+		group.norms_.push_back(std::move(norms));
+	}
+}
+
+void ClipperOffset::DoGroupOffset(const PathGroup& group, double delta, Paths64& solution)
+{
+	CLIPPER_PROFILE("DoGroupOffset");
+	solution.clear();
+	if (group.paths_.empty()) return;
+	const bool is_convex_offset = IsConvexOffset(group, delta);
+	if (group.end_type != EndType::Polygon) delta = std::abs(delta) / 2;
+	if (group.is_reversed) delta = -delta;
+
+	OffsetState state;
+	state.delta = delta;
+	state.join_type = group.join_type;
+	double absDelta = std::abs(state.delta);
 
 	double arcTol = (arc_tolerance_ > floating_point_tolerance ? arc_tolerance_
 		: std::log10(2 + absDelta) * default_arc_tolerance); //empirically derived
@@ -302,99 +463,174 @@ void ClipperOffset::DoGroupOffset(PathGroup& group, double delta)
 //calculate a sensible number of steps (for 360 deg for the given offset
 	if (group.join_type == JoinType::Round || group.end_type == EndType::Round)
 	{
-		steps_per_rad_ = PI / std::acos(1 - arcTol / absDelta) / (PI *2);
+		//nb: arc tolerances greater than 2 * absDelta would otherwise make acos's
+		//argument less than -1 (and so steps_per_rad NaN)
+		const double cos_step = std::max(-1.0, std::min(1.0, 1 - arcTol / absDelta));
+		state.steps_per_rad = PI / std::acos(cos_step) / (PI *2);
+		//round joins and caps turn no more than PI, and every rotation is a
+		//multiple of the same step, so these rotations are calculated just once
+		const size_t step_cnt = static_cast<size_t>(std::ceil(PI * state.steps_per_rad));
+		state.step_vecs.reserve(step_cnt);
+		for (size_t i = 1; i <= step_cnt; ++i)
+		{
+			const double step_angle = i / state.steps_per_rad;
+			state.step_vecs.push_back(PointD(std::cos(step_angle), std::sin(step_angle)));
+		}
 	}
 
-	bool is_closed_path = IsClosedPath(group.end_type);
-	Paths64::const_iterator path_iter;
-	for(path_iter = group.paths_in_.cbegin(); path_iter != group.paths_in_.cend(); ++path_iter)
+	for (Paths64::size_type i = 0; i < group.paths_.size(); ++i)
 	{
-		Path64 path = StripDuplicates(*path_iter, is_closed_path);
-		Path64::size_type cnt = path.size();
-		if (cnt == 0) continue;
-
-		if (cnt == 1) //single point - only valid with open paths
+		const Path64& path = group.paths_[i];
+		if (path.size() == 1) //single point - only valid with open paths
 		{
-			group.path_ = Path64();
+			state.path = Path64();
 			//single vertex so build a circle or square ...
 			if (group.join_type == JoinType::Round)
 			{
-				double radius = std::abs(delta_);
-				if (group.end_type == EndType::Polygon) radius *= 0.5;
-				group.path_ = Ellipse(path[0], radius, radius);
+				//every single vertex circle is the same, so it's built just once
+				if (state.circle.empty())
+				{
+					double radius = absDelta;
+					if (group.end_type == EndType::Polygon) radius *= 0.5;
+					state.circle = Ellipse(PointD(0, 0), radius, radius);
+				}
+				state.path.reserve(state.circle.size());
+				for (const PointD& circle_pt : state.circle)
+					state.path.push_back(Point64(path[0].x + circle_pt.x, path[0].y + circle_pt.y));
 			}
 			else
 			{
-				group.path_.reserve(4);
-				group.path_.push_back(Point64(path[0].x - delta_, path[0].y - delta_));
-				group.path_.push_back(Point64(path[0].x + delta_, path[0].y - delta_));
-				group.path_.push_back(Point64(path[0].x + delta_, path[0].y + delta_));
-				group.path_.push_back(Point64(path[0].x - delta_, path[0].y + delta_));
+				state.path.reserve(4);
+				state.path.push_back(Point64(path[0].x - state.delta, path[0].y - state.delta));
+				state.path.push_back(Point64(path[0].x + state.delta, path[0].y - state.delta));
+				state.path.push_back(Point64(path[0].x + state.delta, path[0].y + state.delta));
+				state.path.push_back(Point64(path[0].x - state.delta, path[0].y + state.delta));
 			}
-			group.paths_out_.push_back(group.path_);
+			state.paths_out.push_back(state.path);
 		}
 		else
 		{
-			BuildNormals(path);
-			if (group.end_type == EndType::Polygon) OffsetPolygon(group, path);
-			else if (group.end_type == EndType::Joined) OffsetOpenJoined(group, path);
-			else OffsetOpenPath(group, path, group.end_type);
+			//nb: open path offsetting modifies normals, so they're copied
+			state.norms = group.norms_[i];
+			if (group.end_type == EndType::Polygon) OffsetPolygon(state, path);
+			else if (group.end_type == EndType::Joined) OffsetOpenJoined(state, path);
+			else OffsetOpenPath(state, path, group.end_type);
 		}
 	}
 
-	if (!merge_groups_)
+	if (merge_groups_)
+		solution.swap(state.paths_out);
+	else if (is_convex_offset && !HaveOverlappingBounds(state.paths_out))
+	{
+		//there are no self-intersections to clean up
+		solution.swap(state.paths_out);
+		TidyConvexOffset(solution, group.is_reversed, preserve_collinear_);
+	}
+	else
 	{
 		//clean up self-intersections ...
+		CLIPPER_PROFILE("Union");
 		Clipper c;
 		c.PreserveCollinear = false;
-		c.AddSubject(group.paths_out_);
+		c.AddSubject(state.paths_out);
 #ifdef REVERSE_ORIENTATION
 		if (!group.is_reversed)
 #else 
 		if (group.is_reversed)
 #endif
-			c.Execute(ClipType::Union, FillRule::Positive, group.paths_out_);
+			c.Execute(ClipType::Union, FillRule::Positive, solution);
 		else
-			c.Execute(ClipType::Union, FillRule::Negative, group.paths_out_);
+			c.Execute(ClipType::Union, FillRule::Negative, solution);
 	}
 }
 
 Paths64 ClipperOffset::Execute(double delta)
 {
-	Paths64 result = Paths64();
-	if (std::abs(delta) < default_arc_tolerance)
-	{
-		for (const PathGroup& group : groups_)
-			result.insert(result.begin(), group.paths_in_.cbegin(), group.paths_in_.cend());
-		return result;
-	}
+	std::vector<Paths64> solutions = Execute(std::vector<double>(1, delta));
+	return std::move(solutions[0]);
+}
+
+std::vector<Paths64> ClipperOffset::Execute(const std::vector<double>& deltas)
+{
+	CLIPPER_PROFILE("ClipperOffset::Execute");
+	std::vector<Paths64> result(deltas.size());
 
 	temp_lim_ = (miter_limit_ <= 1) ? 
 		2.0 : 
 		2.0 / (miter_limit_ * miter_limit_);
 
-	std::vector<PathGroup>::iterator groups_iter;
-	for (groups_iter = groups_.begin(); groups_iter != groups_.end(); ++groups_iter)
+	//paths and their normals are prepared just once, regardless of the number
+	//of deltas (and of the number of times Execute is called)
+	ParallelFor(groups_.size(), thread_count_, [&](size_t group_idx)
 	{
-		DoGroupOffset(*groups_iter, delta);
-		result.swap(groups_iter->paths_out_);
-	}
+		PrepareGroup(groups_[group_idx]);
+	});
+
+	//every group is offset by every delta independently, so these offsets
+	//can all be done concurrently
+	const size_t group_cnt = groups_.size();
+	std::vector<Paths64> group_solutions(deltas.size() * group_cnt);
+	ParallelFor(group_solutions.size(), thread_count_, [&](size_t i)
+	{
+		const double delta = deltas[i / group_cnt];
+		if (std::abs(delta) >= default_arc_tolerance)
+			DoGroupOffset(groups_[i % group_cnt], delta, group_solutions[i]);
+	});
 
-	if (merge_groups_ && groups_.size() > 0)
+	ParallelFor(deltas.size(), thread_count_, [&](size_t delta_idx)
 	{
+		Paths64& solution = result[delta_idx];
+		if (std::abs(deltas[delta_idx]) < default_arc_tolerance)
+		{
+			for (const PathGroup& group : groups_)
+				solution.insert(solution.begin(), group.paths_in_.cbegin(), group.paths_in_.cend());
+			return;
+		}
+
+		size_t path_cnt = 0;
+		for (size_t i = 0; i < group_cnt; ++i)
+			path_cnt += group_solutions[delta_idx * group_cnt + i].size();
+		solution.reserve(path_cnt);
+		for (size_t i = 0; i < group_cnt; ++i)
+		{
+			Paths64& group_solution = group_solutions[delta_idx * group_cnt + i];
+			solution.insert(solution.end(),
+				std::make_move_iterator(group_solution.begin()),
+				std::make_move_iterator(group_solution.end()));
+			group_solution = Paths64();
+		}
+
+		if (!merge_groups_ || group_cnt == 0) return;
+		//when every group's offset paths are convex, and all their bounds are
+		//separate, there are no intersections to clean up
+		bool can_skip_union = true;
+		for (const PathGroup& group : groups_)
+			if (group.is_reversed != groups_[0].is_reversed ||
+				!IsConvexOffset(group, deltas[delta_idx]))
+			{
+				can_skip_union = false;
+				break;
+			}
+		if (can_skip_union && !HaveOverlappingBounds(solution))
+		{
+			TidyConvexOffset(solution, groups_[0].is_reversed, preserve_collinear_);
+			return;
+		}
+
 		//clean up self-intersections ...
+		CLIPPER_PROFILE("MergeUnion");
 		Clipper c;
 		c.PreserveCollinear = false;
-		c.AddSubject(result);
+		c.AddSubject(solution);
 #ifdef REVERSE_ORIENTATION
 		if (!groups_[0].is_reversed)
 #else 
 		if (groups_[0].is_reversed)
 #endif
-			c.Execute(ClipType::Union, FillRule::Positive, result);
+			c.Execute(ClipType::Union, FillRule::Positive, solution);
 		else
-			c.Execute(ClipType::Union, FillRule::Negative, result);
-	}
+			c.Execute(ClipType::Union, FillRule::Negative, solution);
+	});
 	return result;
 }
 
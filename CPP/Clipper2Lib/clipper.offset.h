@@ -27,38 +27,55 @@ enum class EndType {Polygon, Joined, Butt, Square, Round};
 class PathGroup {
 public:
 	Paths64 paths_in_;
-	Paths64 paths_out_;
-	Path64 path_;
+	//paths_ (paths_in_ without duplicate vertices), their normals and the
+	//group's orientation are prepared just once (see PrepareGroup) and are
+	//then reused by every offset of the group
+	Paths64 paths_;
+	std::vector<PathD> norms_;
+	std::vector<int> convexity_;  //polygons only (see GetConvexity)
+	bool is_prepared_ = false;
 	bool is_reversed = false;
 	JoinType join_type;
 	EndType end_type;
 	PathGroup(const Paths64& paths, JoinType join_type, EndType end_type):
 		paths_in_(paths), join_type(join_type), end_type(end_type) {}
+	PathGroup(Paths64&& paths, JoinType join_type, EndType end_type):
+		paths_in_(std::move(paths)), join_type(join_type), end_type(end_type) {}
+};
+
+//OffsetState: what's needed while offsetting a group by a single delta. (Each
+//offset has its own OffsetState, so groups and deltas can be offset concurrently.)
+struct OffsetState {
+	PathD norms;
+	Path64 path;
+	Paths64 paths_out;
+	double delta = 0.0;
+	double steps_per_rad = 0.0;
+	PathD step_vecs;  //unit vectors rotated by 1, 2, 3 ... steps (round joins)
+	PathD circle;     //the circle around single vertices, centered on 0,0
+	JoinType join_type = JoinType::Square;
 };
 
 class ClipperOffset {
 private:
-	double delta_ = 0.0;
 	double temp_lim_ = 0.0;
-	double steps_per_rad_ = 0.0;
-	PathD norms;
 	std::vector<PathGroup> groups_;
-	JoinType join_type_ = JoinType::Square;
 	
 	double miter_limit_ = 0.0;
 	double arc_tolerance_ = 0.0;
 	bool merge_groups_ = true;
 	bool preserve_collinear_ = false;
+	unsigned thread_count_ = 1;
 
-	void DoSquare(PathGroup& group, const Path64& path, size_t j, size_t k);
-	void DoMiter(PathGroup& group, const Path64& path, size_t j, size_t k, double cos_a);
-	void DoRound(PathGroup& group, const Point64& pt, const PointD& norm1, const PointD& norm2, double angle);
-	void BuildNormals(const Path64& path);
-	void OffsetPolygon(PathGroup& group, Path64& path);
-	void OffsetOpenJoined(PathGroup& group, Path64& path);
-	void OffsetOpenPath(PathGroup& group, Path64& path, EndType endType);
-	void OffsetPoint(PathGroup& group, Path64& path, size_t j, size_t& k);
-	void DoGroupOffset(PathGroup &group, double delta);
+	void DoSquare(OffsetState& state, const Path64& path, size_t j, size_t k);
+	void DoMiter(OffsetState& state, const Path64& path, size_t j, size_t k, double cos_a);
+	void DoRound(OffsetState& state, const Point64& pt, const PointD& norm1, const PointD& norm2, double angle);
+	void OffsetPolygon(OffsetState& state, const Path64& path);
+	void OffsetOpenJoined(OffsetState& state, const Path64& path);
+	void OffsetOpenPath(OffsetState& state, const Path64& path, EndType endType);
+	void OffsetPoint(OffsetState& state, const Path64& path, size_t j, size_t& k);
+	void PrepareGroup(PathGroup& group);
+	void DoGroupOffset(const PathGroup& group, double delta, Paths64& solution);
 public:
 	ClipperOffset(double miter_limit = 2.0, 
 		double arc_tolerance = 0.0, int precision = 2, bool preserve_collinear = false) :
@@ -69,11 +86,16 @@ public:
 
 	void AddPath(const Path64& path, JoinType jt_, EndType et_);
 	void AddPaths(const Paths64& paths, JoinType jt_, EndType et_);
+	void AddPaths(Paths64&& paths, JoinType jt_, EndType et_);
 	void AddPath(const PathD &p, JoinType jt_, EndType et_);
 	void AddPaths(const PathsD &p, JoinType jt_, EndType et_);
-	void Clear() { groups_.clear(); norms.clear(); };
+	void Clear() { groups_.clear(); };
 	
 	Paths64 Execute(double delta);
+	//Execute: returns a solution for each delta. This is much faster than
+	//calling Execute separately for each delta since paths are prepared (and
+	//their normals calculated) just once.
+	std::vector<Paths64> Execute(const std::vector<double>& deltas);
 
 	double MiterLimit() const { return miter_limit_; }
 	void MiterLimit(double miter_limit) { miter_limit_ = miter_limit; }
@@ -93,6 +115,12 @@ public:
 	void PreserveCollinear(bool preserve_collinear) { 
 		preserve_collinear_ = preserve_collinear; 
 	}
+
+	//ThreadCount: when greater than 1, path groups (and deltas) are offset
+	//concurrently, as are merging unions. Since groups and deltas are offset
+	//independently, solutions are the same regardless of ThreadCount.
+	unsigned ThreadCount() const { return thread_count_; }
+	void ThreadCount(unsigned thread_count) { thread_count_ = thread_count; }
 };
 
 }
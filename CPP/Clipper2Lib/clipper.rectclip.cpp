@@ -0,0 +1,440 @@
+/*******************************************************************************
+* Author    :  Angus Johnson                                                   *
+* Version   :  10.0 (beta) - aka Clipper2                                      *
+* Date      :  16 October 2022                                                 *
+* Website   :  http://www.angusj.com                                           *
+* Copyright :  Angus Johnson 2010-2022                                         *
+* Purpose   :  Fast clipping of paths and lines to rectangles                  *
+* License   :  http://www.boost.org/LICENSE_1_0.txt                            *
+*******************************************************************************/
+
+#include <cmath>
+#include <algorithm>
+#include "clipper.rectclip.h"
+
+namespace Clipper2Lib {
+
+//------------------------------------------------------------------------------
+// Miscellaneous functions
+//------------------------------------------------------------------------------
+
+inline Rect64 GetBounds(const Path64& path)
+{
+	Rect64 result(path[0].x, path[0].y, path[0].x, path[0].y);
+	for (const Point64& pt : path)
+	{
+		if (pt.x < result.left) result.left = pt.x;
+		else if (pt.x > result.right) result.right = pt.x;
+		if (pt.y < result.top) result.top = pt.y;
+		else if (pt.y > result.bottom) result.bottom = pt.y;
+	}
+	return result;
+}
+
+inline bool IsInside(const Rect64& rect, const Rect64& rec)
+{
+	return rec.left >= rect.left && rec.right <= rect.right &&
+		rec.top >= rect.top && rec.bottom <= rect.bottom;
+}
+
+inline bool IsSeparate(const Rect64& rect, const Rect64& rec)
+{
+	return rec.right < rect.left || rec.left > rect.right ||
+		rec.bottom < rect.top || rec.top > rect.bottom;
+}
+
+inline Point64 ClampToRect(const Rect64& rect, const Point64& pt)
+{
+	Point64 result = pt;
+	result.x = std::max(rect.left, std::min(rect.right, pt.x));
+	result.y = std::max(rect.top, std::min(rect.bottom, pt.y));
+	return result;
+}
+
+inline int GetEdgeSide(const Rect64& rect, const Point64& pt1, const Point64& pt2)
+{
+	//returns the side (0: left, 1: top, 2: right, 3: bottom) that the edge
+	//pt1-pt2 lies on, or -1 if it isn't on any side
+	if (pt1.x == pt2.x)
+	{
+		if (pt1.x == rect.left) return 0;
+		else if (pt1.x == rect.right) return 2;
+	}
+	else if (pt1.y == pt2.y)
+	{
+		if (pt1.y == rect.top) return 1;
+		else if (pt1.y == rect.bottom) return 3;
+	}
+	return -1;
+}
+
+inline bool IsCollinearOnSide(const Rect64& rect,
+	const Point64& pt1, const Point64& pt2, const Point64& pt3)
+{
+	//nb: this includes 'spikes' where pt3 doubles back over pt2
+	return (pt1.x == pt2.x && pt2.x == pt3.x &&
+		(pt1.x == rect.left || pt1.x == rect.right)) ||
+		(pt1.y == pt2.y && pt2.y == pt3.y &&
+		(pt1.y == rect.top || pt1.y == rect.bottom));
+}
+
+//------------------------------------------------------------------------------
+// RectClip64 methods
+//------------------------------------------------------------------------------
+
+void RectClip64::AddPoint(Path64& path, const Point64& pt) const
+{
+	//since edges along the rectangle's sides can only have the rectangle on
+	//one side, collinear points (and spikes) on these sides can be removed
+	while (path.size() > 1 &&
+		IsCollinearOnSide(rect_, path[path.size() - 2], path.back(), pt))
+			path.pop_back();
+	if (path.empty() || path.back() != pt) path.push_back(pt);
+}
+
+void RectClip64::AddCrossings(Path64& path,
+	const Point64& pt1, const Point64& pt2) const
+{
+	//adds (clamped) points where the segment pt1-pt2 crosses the lines that
+	//extend the rectangle's sides, in their order from pt1
+	double ts[4];
+	Point64 pts[4];
+	size_t cnt = 0;
+	const double dx = static_cast<double>(pt2.x - pt1.x);
+	const double dy = static_cast<double>(pt2.y - pt1.y);
+
+	const int64_t xs[2] = { rect_.left, rect_.right };
+	for (int64_t x : xs)
+	{
+		if ((pt1.x < x && pt2.x > x) || (pt1.x > x && pt2.x < x))
+		{
+			ts[cnt] = static_cast<double>(x - pt1.x) / dx;
+			pts[cnt] = Point64(x,
+				pt1.y + static_cast<int64_t>(std::round(ts[cnt] * dy)));
+			++cnt;
+		}
+	}
+	const int64_t ys[2] = { rect_.top, rect_.bottom };
+	for (int64_t y : ys)
+	{
+		if ((pt1.y < y && pt2.y > y) || (pt1.y > y && pt2.y < y))
+		{
+			ts[cnt] = static_cast<double>(y - pt1.y) / dy;
+			pts[cnt] = Point64(
+				pt1.x + static_cast<int64_t>(std::round(ts[cnt] * dx)), y);
+			++cnt;
+		}
+	}
+
+	for (size_t i = 1; i < cnt; ++i)
+		for (size_t j = i; j > 0 && ts[j] < ts[j - 1]; --j)
+		{
+			std::swap(ts[j], ts[j - 1]);
+			std::swap(pts[j], pts[j - 1]);
+		}
+	for (size_t i = 0; i < cnt; ++i)
+		AddPoint(path, ClampToRect(rect_, pts[i]));
+}
+
+void RectClip64::TidyEnds(Path64& path) const
+{
+	//removes duplicates and collinear points where the path's end meets its start
+	while (path.size() > 2)
+	{
+		const size_t len = path.size();
+		if (path[len - 1] == path[0] ||
+			IsCollinearOnSide(rect_, path[len - 2], path[len - 1], path[0]))
+				path.pop_back();
+		else if (IsCollinearOnSide(rect_, path[len - 1], path[0], path[1]))
+			path.erase(path.begin());
+		else
+			break;
+	}
+}
+
+void RectClip64::AddSplitPaths(Paths64& result)
+{
+	//Where a path leaves the rectangle and later re-enters it, the path will
+	//have overlapping edges along the rectangle's sides. If edges A->B and C->D
+	//overlap, then the path (A->B ... C->D ... A) can be split into the paths
+	//(B ... C->B) and (D ... A->D) without changing any winding numbers
+	//since all four points are collinear. Rather than splitting one pair at a
+	//time, all the side edges' starts and ends are sorted (by side and then
+	//position) and each start is rejoined to the nearest unmatched end in a
+	//single pass, so no side edges overlap unless the path wraps more than once.
+	const size_t len = path_.size();
+	side_ends_.clear();
+	for (size_t i = 0; i < len; ++i)
+	{
+		const size_t j = (i + 1 == len) ? 0 : i + 1;
+		const int side = GetEdgeSide(rect_, path_[i], path_[j]);
+		if (side < 0) continue;
+		const bool is_vert = (side % 2 == 0);
+		side_ends_.push_back(SideEnd{ side,
+			is_vert ? path_[i].y : path_[i].x, true, i });
+		side_ends_.push_back(SideEnd{ side,
+			is_vert ? path_[j].y : path_[j].x, false, j });
+	}
+	if (side_ends_.size() < 4)
+	{
+		result.push_back(std::move(path_));
+		return;
+	}
+
+	//nb: at the same position, ends precede starts so edges that only touch
+	//aren't rejoined
+	std::sort(side_ends_.begin(), side_ends_.end(),
+		[](const SideEnd& a, const SideEnd& b)
+		{
+			if (a.side != b.side) return a.side < b.side;
+			if (a.pos != b.pos) return a.pos < b.pos;
+			if (a.is_start != b.is_start) return b.is_start;
+			return a.idx < b.idx;
+		});
+	next_idx_.resize(len);
+	for (size_t i = 0; i < len; ++i)
+		next_idx_[i] = (i + 1 == len) ? 0 : i + 1;
+	//(nb: each side has as many starts as ends, so when one side's starts and
+	//ends have all been matched, unmatched_ is empty for the next side)
+	unmatched_.clear();
+	for (const SideEnd& side_end : side_ends_)
+	{
+		if (unmatched_.empty() || unmatched_.back()->is_start == side_end.is_start)
+		{
+			unmatched_.push_back(&side_end);
+			continue;
+		}
+		const SideEnd* other = unmatched_.back();
+		unmatched_.pop_back();
+		if (side_end.is_start)
+			next_idx_[side_end.idx] = other->idx;
+		else
+			next_idx_[other->idx] = side_end.idx;
+	}
+
+	//next_idx_ is now a permutation, and each of its cycles is a split path
+	//(nb: paths with no area aren't discarded since, like bow-ties, they may
+	//still have non-zero winding numbers)
+	const size_t visited = len;
+	for (size_t i = 0; i < len; ++i)
+	{
+		if (next_idx_[i] == visited) continue;
+		Path64 path;
+		size_t j = i;
+		do
+		{
+			AddPoint(path, path_[j]);
+			const size_t k = next_idx_[j];
+			next_idx_[j] = visited;
+			j = k;
+		} while (j != i);
+		TidyEnds(path);
+		if (path.size() > 2) result.push_back(std::move(path));
+	}
+}
+
+void RectClip64::ClipPath(const Path64& path, Paths64& result)
+{
+	path_.clear();
+	const Point64* prev_pt = &path.back();
+	for (const Point64& pt : path)
+	{
+		AddCrossings(path_, *prev_pt, pt);
+		AddPoint(path_, ClampToRect(rect_, pt));
+		prev_pt = &pt;
+	}
+	TidyEnds(path_);
+	if (path_.size() > 2) AddSplitPaths(result);
+}
+
+void RectClip64::Execute(const Path64& path,
+	const Rect64& path_rec, Paths64& result)
+{
+	if (path.size() < 3 || IsSeparate(rect_, path_rec)) return;
+	else if (IsInside(rect_, path_rec)) result.push_back(path);
+	else ClipPath(path, result);
+}
+
+Paths64 RectClip64::Execute(const Paths64& paths)
+{
+	Paths64 result;
+	if (rect_.IsEmpty()) return result;
+	for (const Path64& path : paths)
+		if (path.size() > 2) Execute(path, GetBounds(path), result);
+	return result;
+}
+
+//------------------------------------------------------------------------------
+// RectClipLines64 methods
+//------------------------------------------------------------------------------
+
+bool RectClipLines64::ClipSegment(const Point64& pt1, const Point64& pt2,
+	double& t1, double& t2) const
+{
+	//Liang-Barsky: t1 and t2 are where the segment enters and leaves the
+	//rectangle (as fractions of the segment's length from pt1)
+	const double dx = static_cast<double>(pt2.x - pt1.x);
+	const double dy = static_cast<double>(pt2.y - pt1.y);
+	const double p[4] = { -dx, dx, -dy, dy };
+	const double q[4] = {
+		static_cast<double>(pt1.x - rect_.left),
+		static_cast<double>(rect_.right - pt1.x),
+		static_cast<double>(pt1.y - rect_.top),
+		static_cast<double>(rect_.bottom - pt1.y) };
+	t1 = 0;
+	t2 = 1;
+	for (int i = 0; i < 4; ++i)
+	{
+		if (p[i] == 0)
+		{
+			if (q[i] < 0) return false;
+			continue;
+		}
+		const double t = q[i] / p[i];
+		if (p[i] < 0)
+		{
+			if (t > t2) return false;
+			else if (t > t1) t1 = t;
+		}
+		else
+		{
+			if (t < t1) return false;
+			else if (t < t2) t2 = t;
+		}
+	}
+	return true;
+}
+
+Point64 RectClipLines64::GetPointAt(const Point64& pt1,
+	const Point64& pt2, double t) const
+{
+	return ClampToRect(rect_, Point64(
+		pt1.x + static_cast<int64_t>(std::round(t * (pt2.x - pt1.x))),
+		pt1.y + static_cast<int64_t>(std::round(t * (pt2.y - pt1.y)))));
+}
+
+void RectClipLines64::ClipLine(const Path64& path, Paths64& result) const
+{
+	Path64 line;
+	for (size_t i = 1; i < path.size(); ++i)
+	{
+		const Point64& pt1 = path[i - 1];
+		const Point64& pt2 = path[i];
+		double t1, t2;
+		if (!ClipSegment(pt1, pt2, t1, t2))
+		{
+			if (line.size() > 1) result.push_back(std::move(line));
+			line.clear();
+			continue;
+		}
+
+		const Point64 entry_pt = (t1 > 0) ? GetPointAt(pt1, pt2, t1) : pt1;
+		if (line.empty() || line.back() != entry_pt)
+		{
+			if (line.size() > 1) result.push_back(std::move(line));
+			line.clear();
+			line.push_back(entry_pt);
+		}
+		const Point64 exit_pt = (t2 < 1) ? GetPointAt(pt1, pt2, t2) : pt2;
+		if (exit_pt != line.back()) line.push_back(exit_pt);
+		if (t2 < 1)
+		{
+			if (line.size() > 1) result.push_back(std::move(line));
+			line.clear();
+		}
+	}
+	if (line.size() > 1) result.push_back(std::move(line));
+}
+
+void RectClipLines64::Execute(const Path64& path,
+	const Rect64& path_rec, Paths64& result) const
+{
+	if (path.size() < 2 || IsSeparate(rect_, path_rec)) return;
+	else if (IsInside(rect_, path_rec)) result.push_back(path);
+	else ClipLine(path, result);
+}
+
+Paths64 RectClipLines64::Execute(const Paths64& paths) const
+{
+	Paths64 result;
+	if (rect_.IsEmpty()) return result;
+	for (const Path64& path : paths)
+		if (path.size() > 1) Execute(path, GetBounds(path), result);
+	return result;
+}
+
+//------------------------------------------------------------------------------
+// RectClipTiles64 methods
+//------------------------------------------------------------------------------
+
+inline int64_t FloorDiv(int64_t a, int64_t b)
+{
+	//b > 0
+	return (a >= 0) ? a / b : -((b - 1 - a) / b);
+}
+
+Rect64 TileGrid::GetTile(size_t row, size_t col) const
+{
+	const int64_t left = origin.x + static_cast<int64_t>(col) * tile_width;
+	const int64_t top = origin.y + static_cast<int64_t>(row) * tile_height;
+	return Rect64(left, top, left + tile_width, top + tile_height);
+}
+
+void RectClipTiles64::AssignPaths(const Paths64& paths, size_t min_path_len)
+{
+	//a single pass over paths that adds each path to just those tiles that
+	//its bounds overlap
+	const int64_t cols = static_cast<int64_t>(grid_.cols);
+	const int64_t rows = static_cast<int64_t>(grid_.rows);
+	path_bounds_.resize(paths.size());
+	tile_paths_.assign(grid_.TileCount(), std::vector<size_t>());
+	for (size_t i = 0; i < paths.size(); ++i)
+	{
+		if (paths[i].size() < min_path_len) continue;
+		const Rect64 rec = GetBounds(paths[i]);
+		path_bounds_[i] = rec;
+		const int64_t col_first = std::max(int64_t(0),
+			FloorDiv(rec.left - grid_.origin.x, grid_.tile_width));
+		const int64_t col_last = std::min(cols - 1,
+			FloorDiv(rec.right - grid_.origin.x, grid_.tile_width));
+		const int64_t row_first = std::max(int64_t(0),
+			FloorDiv(rec.top - grid_.origin.y, grid_.tile_height));
+		const int64_t row_last = std::min(rows - 1,
+			FloorDiv(rec.bottom - grid_.origin.y, grid_.tile_height));
+		for (int64_t row = row_first; row <= row_last; ++row)
+			for (int64_t col = col_first; col <= col_last; ++col)
+				tile_paths_[static_cast<size_t>(row * cols + col)].push_back(i);
+	}
+}
+
+std::vector<Paths64> RectClipTiles64::Execute(const Paths64& paths,
+	unsigned thread_count)
+{
+	std::vector<Paths64> result(grid_.TileCount());
+	if (grid_.IsEmpty()) return result;
+	AssignPaths(paths, 3);
+	ParallelFor(result.size(), thread_count, [&](size_t tile_idx)
+	{
+		RectClip64 rc(grid_.GetTile(tile_idx / grid_.cols, tile_idx % grid_.cols));
+		for (size_t path_idx : tile_paths_[tile_idx])
+			rc.Execute(paths[path_idx], path_bounds_[path_idx], result[tile_idx]);
+	});
+	return result;
+}
+
+std::vector<Paths64> RectClipTiles64::ExecuteLines(const Paths64& lines,
+	unsigned thread_count)
+{
+	std::vector<Paths64> result(grid_.TileCount());
+	if (grid_.IsEmpty()) return result;
+	AssignPaths(lines, 2);
+	ParallelFor(result.size(), thread_count, [&](size_t tile_idx)
+	{
+		const RectClipLines64 rcl(grid_.GetTile(tile_idx / grid_.cols, tile_idx % grid_.cols));
+		for (size_t path_idx : tile_paths_[tile_idx])
+			rcl.Execute(lines[path_idx], path_bounds_[path_idx], result[tile_idx]);
+	});
+	return result;
+}
+
+}  //namespace
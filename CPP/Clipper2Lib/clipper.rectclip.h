@@ -0,0 +1,108 @@
+/*******************************************************************************
+* Author    :  Angus Johnson                                                   *
+* Version   :  10.0 (beta) - aka Clipper2                                      *
+* Date      :  16 October 2022                                                 *
+* Website   :  http://www.angusj.com                                           *
+* Copyright :  Angus Johnson 2010-2022                                         *
+* Purpose   :  Fast clipping of paths and lines to rectangles                  *
+* License   :  http://www.boost.org/LICENSE_1_0.txt                            *
+*******************************************************************************/
+
+#ifndef CLIPPER_RECTCLIP_H
+#define CLIPPER_RECTCLIP_H
+
+#include <vector>
+#include "clipper.core.h"
+
+namespace Clipper2Lib {
+
+//RectClip64: clips closed paths to a rectangle in (almost) linear time (ie
+//much faster than the general clipping engine). Each path is walked just
+//once, with the path's vertices outside the rectangle moved onto the
+//rectangle's edges (or corners), and with new vertices added wherever the
+//path crosses the rectangle's edges. This preserves winding numbers inside
+//the rectangle. Then where a path leaves and later re-enters the rectangle,
+//the path is split (after sorting just its edges along the rectangle's sides)
+//so solutions won't contain overlapping edges along the rectangle's sides. However, unlike the clipping engine, self-intersections and overlaps
+//between paths are NOT removed, and path orientation is preserved.
+class RectClip64 {
+private:
+	//SideEnd: the start or end of a path edge that's along one of the sides
+	struct SideEnd {
+		int side;
+		int64_t pos;  //the position along the side
+		bool is_start;
+		size_t idx;   //the index of the start or end vertex in path_
+	};
+	const Rect64 rect_;
+	Path64 path_;
+	std::vector<SideEnd> side_ends_;
+	std::vector<const SideEnd*> unmatched_;
+	std::vector<size_t> next_idx_;
+	void AddPoint(Path64& path, const Point64& pt) const;
+	void AddCrossings(Path64& path, const Point64& pt1, const Point64& pt2) const;
+	void TidyEnds(Path64& path) const;
+	void AddSplitPaths(Paths64& result);
+	void ClipPath(const Path64& path, Paths64& result);
+public:
+	explicit RectClip64(const Rect64& rect) : rect_(rect) {}
+	Paths64 Execute(const Paths64& paths);
+	//clips a single path (whose bounds are already known), appending to result
+	void Execute(const Path64& path, const Rect64& path_rec, Paths64& result);
+};
+
+//RectClipLines64: clips open paths (polylines) to a rectangle in linear time.
+//Each segment is clipped to the rectangle (Liang-Barsky), and whenever a path
+//leaves the rectangle, its clipped part is returned as a separate path.
+class RectClipLines64 {
+private:
+	const Rect64 rect_;
+	bool ClipSegment(const Point64& pt1, const Point64& pt2,
+		double& t1, double& t2) const;
+	Point64 GetPointAt(const Point64& pt1, const Point64& pt2, double t) const;
+	void ClipLine(const Path64& path, Paths64& result) const;
+public:
+	explicit RectClipLines64(const Rect64& rect) : rect_(rect) {}
+	Paths64 Execute(const Paths64& paths) const;
+	void Execute(const Path64& path, const Rect64& path_rec, Paths64& result) const;
+};
+
+//TileGrid: rows * cols abutting tiles, each tile_width * tile_height, with
+//the top-left corner of tile (0, 0) at origin
+struct TileGrid {
+	Point64 origin;
+	int64_t tile_width = 0;
+	int64_t tile_height = 0;
+	size_t rows = 0;
+	size_t cols = 0;
+
+	TileGrid() {};
+	TileGrid(const Point64& origin_, int64_t tile_width_, int64_t tile_height_,
+		size_t rows_, size_t cols_) : origin(origin_), tile_width(tile_width_),
+		tile_height(tile_height_), rows(rows_), cols(cols_) {};
+	bool IsEmpty() const { return tile_width <= 0 || tile_height <= 0 || !rows || !cols; };
+	size_t TileCount() const { return rows * cols; };
+	Rect64 GetTile(size_t row, size_t col) const;
+};
+
+//RectClipTiles64: clips paths to every tile in a TileGrid (eg when generating
+//vector tiles). Rather than clipping every path against every tile, a single
+//pass over the paths assigns each path to just the tiles its bounds overlap,
+//and then each tile is clipped (using RectClip64 or RectClipLines64), with
+//tiles clipped concurrently when thread_count > 1. Solutions are returned in
+//row-major order (ie tile (row, col) is result[row * grid.cols + col]).
+class RectClipTiles64 {
+private:
+	const TileGrid grid_;
+	std::vector<Rect64> path_bounds_;
+	std::vector<std::vector<size_t>> tile_paths_;
+	void AssignPaths(const Paths64& paths, size_t min_path_len);
+public:
+	explicit RectClipTiles64(const TileGrid& grid) : grid_(grid) {}
+	std::vector<Paths64> Execute(const Paths64& paths, unsigned thread_count = 1);
+	std::vector<Paths64> ExecuteLines(const Paths64& lines, unsigned thread_count = 1);
+};
+
+}  //namespace
+
+#endif  // CLIPPER_RECTCLIP_H
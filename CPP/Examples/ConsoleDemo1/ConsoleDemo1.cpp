@@ -7,6 +7,7 @@
 #include "../../Utils/ClipFileLoad.h"
 #include "../../Utils/ClipFileSave.h"
 #include "../../Utils/Timer.h"
+#include "../../Utils/Profiler.h"
 
 using namespace Clipper2Lib;
 
@@ -19,6 +20,9 @@ void RunSavedTests(const std::string& filename,
   const int start_num, const int end_num,
   bool svg_draw, bool show_solution_coords);
 void DoBenchmark(int edge_cnt_start, int edge_cnt_end, int increment);
+void DoActiveEdgesBenchmark(int poly_cnt_start, int poly_cnt_end, int increment);
+void DoSliversBenchmark(int sliver_cnt_start, int sliver_cnt_end, int increment);
+void DoRectClipLinesBenchmark(int line_cnt_start, int line_cnt_end, int increment);
 void DoMemoryLeakTest();
 
 int main()
@@ -49,6 +53,9 @@ int main()
     std::cout << "Benchmarks" << std::endl;
     std::cout << "==========" << std::endl;
     DoBenchmark(1000, 3000, 1000);
+    DoActiveEdgesBenchmark(2000, 8000, 2000);
+    DoSliversBenchmark(10000, 30000, 10000);
+    DoRectClipLinesBenchmark(10000, 30000, 10000);
     if (test_type == TestType::Benchmark) break;
 
   case TestType::MemoryLeak:
@@ -212,6 +219,7 @@ void DoBenchmark(int edge_cnt_start, int edge_cnt_end, int increment)
   Paths64 subject, clip, solution;
 
   std::cout << std::endl << "Complex Polygons Benchmark:  " << std::endl;
+  Profiler::Reset();
   for (int i = edge_cnt_start; i <= edge_cnt_end; i += increment)
   {
     subject.clear();
@@ -223,10 +231,13 @@ void DoBenchmark(int edge_cnt_start, int edge_cnt_end, int increment)
     std::cout << "Edge Count: " << i << " = ";
     {
       Timer t("");
+      ProfileScope scope("Edge Count " + std::to_string(i));
       solution = BooleanOp(ct_benchmark, fr_benchmark, subject, clip);
       if (solution.empty()) break;
     }
   }
+  //nb: engine phases are only profiled when USINGPROFILER is defined
+  std::cout << std::endl << Profiler::ToCsv(Profiler::Report());
   
   SvgWriter svg;
   SvgAddSubject(svg, subject);
@@ -237,6 +248,114 @@ void DoBenchmark(int edge_cnt_start, int edge_cnt_end, int increment)
   system("solution3.svg");
 }
 
+void DoActiveEdgesBenchmark(int poly_cnt_start, int poly_cnt_end, int increment)
+{
+  //lots of tall narrow (and jagged) polygons that overlap their neighbours
+  //so there are many thousands of edges in the AEL at every scanline
+  const int height = 100000, steps = 50;
+  Paths64 subject, solution;
+
+  std::cout << std::endl << "Active Edges Benchmark:  " << std::endl;
+  for (int i = poly_cnt_start; i <= poly_cnt_end; i += increment)
+  {
+    subject.clear();
+    subject.reserve(i);
+    for (int j = 0; j < i; ++j)
+    {
+      Path64 path;
+      path.reserve(2 * (steps + 1));
+      int x = j * 20;
+      for (int k = 0; k <= steps; ++k)
+        path.push_back(Point64(x + rand() % 60, k * height / steps));
+      for (int k = steps; k >= 0; --k)
+        path.push_back(Point64(x + 30 + rand() % 60, k * height / steps));
+      subject.push_back(path);
+    }
+
+    std::cout << "Active Edges: " << i * 2 << " = ";
+    {
+      Timer t("");
+      solution = Union(subject, FillRule::NonZero);
+      if (solution.empty()) break;
+    }
+  }
+}
+
+void DoSliversBenchmark(int sliver_cnt_start, int sliver_cnt_end, int increment)
+{
+  //a 'hatch' pattern of narrow vertical slivers in 4 interleaved rows, each
+  //row starting a little higher than the previous one, so every row's local
+  //minima must be inserted into an AEL already crowded with edges
+  const int rows = 4;
+  Paths64 subject, solution;
+
+  std::cout << std::endl << "Slivers Benchmark:  " << std::endl;
+  for (int i = sliver_cnt_start; i <= sliver_cnt_end; i += increment)
+  {
+    subject.clear();
+    subject.reserve(i);
+    for (int row = 0; row < rows; ++row)
+      for (int j = 0; j < i / rows; ++j)
+      {
+        int64_t x = j * 40 + row * 10, y = row * 100;
+        subject.push_back(Path64{ Point64(x, y), Point64(x + 3, y),
+          Point64(x + 3, y + 1000), Point64(x, y + 1000) });
+      }
+
+    std::cout << "Slivers: " << i << " = ";
+    {
+      Timer t("");
+      solution = Union(subject, FillRule::NonZero);
+      if (solution.empty()) break;
+    }
+  }
+}
+
+void DoRectClipLinesBenchmark(int line_cnt_start, int line_cnt_end, int increment)
+{
+  //many short random-walk polylines clipped to a rectangle, first using the
+  //general clipping engine and then using RectClipLines
+  const int width = 8000, height = 6000, vert_cnt = 20, step = 100;
+  const Rect64 rect(width / 4, height / 4, width * 3 / 4, height * 3 / 4);
+  const Paths64 clip{ Path64{ Point64(rect.left, rect.top),
+    Point64(rect.right, rect.top), Point64(rect.right, rect.bottom),
+    Point64(rect.left, rect.bottom) } };
+  Paths64 lines, solution, solution_open;
+
+  std::cout << std::endl << "RectClipLines Benchmark:  " << std::endl;
+  for (int i = line_cnt_start; i <= line_cnt_end; i += increment)
+  {
+    lines.clear();
+    lines.reserve(i);
+    for (int j = 0; j < i; ++j)
+    {
+      Path64 line;
+      line.reserve(vert_cnt);
+      int64_t x = rand() % width, y = rand() % height;
+      for (int k = 0; k < vert_cnt; ++k)
+      {
+        line.push_back(Point64(x, y));
+        x += rand() % (2 * step + 1) - step;
+        y += rand() % (2 * step + 1) - step;
+      }
+      lines.push_back(line);
+    }
+
+    std::cout << "Lines: " << i << std::endl;
+    {
+      Timer t("", "  Clipper64:     ");
+      Clipper64 c;
+      c.AddOpenSubject(lines);
+      c.AddClip(clip);
+      c.Execute(ClipType::Intersection, FillRule::NonZero, solution, solution_open);
+    }
+    {
+      Timer t("", "  RectClipLines: ");
+      solution_open = RectClipLines(rect, lines);
+    }
+  }
+}
+
 void DoMemoryLeakTest()
 {
   int edge_cnt = 1000;
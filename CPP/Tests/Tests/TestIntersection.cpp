@@ -1,4 +1,6 @@
 #include <gtest/gtest.h>
+#include <memory>
+#include <thread>
 #include "../../Clipper2Lib/clipper.h"
 
 TEST(Clipper2Tests, TestBasicIntersection) {
@@ -34,3 +36,149 @@ TEST(Clipper2Tests, TestBasicIntersection) {
     ASSERT_EQ(solution.ChildCount(), 1);
     EXPECT_EQ(solution.childs.front()->polygon.size(), 4);
 }
+
+TEST(Clipper2Tests, TestSeparatedIntersection) {
+    const Clipper2Lib::Paths64 subjects = {{
+        Clipper2Lib::Point64(0, 0),
+        Clipper2Lib::Point64(5, 5),
+        Clipper2Lib::Point64(5, 0),
+        Clipper2Lib::Point64(0, 5)
+    }};
+
+    const Clipper2Lib::Paths64 clips = {{
+        Clipper2Lib::Point64(6, 1),
+        Clipper2Lib::Point64(6, 6),
+        Clipper2Lib::Point64(11, 6),
+        Clipper2Lib::Point64(11, 1)
+    }};
+
+    Clipper2Lib::Clipper64 clipper;
+    clipper.AddSubject(subjects);
+    clipper.AddClip(clips);
+    Clipper2Lib::Paths64 solution;
+    EXPECT_TRUE(clipper.Execute(Clipper2Lib::ClipType::Intersection,
+        Clipper2Lib::FillRule::NonZero, solution));
+    EXPECT_EQ(solution.size(), 0);
+    EXPECT_EQ(Clipper2Lib::Intersect(subjects, clips, Clipper2Lib::FillRule::NonZero).size(), 0);
+
+    //differences of separated paths are just the (cleaned) subjects
+    const Clipper2Lib::Paths64 expected = Clipper2Lib::Union(subjects, Clipper2Lib::FillRule::NonZero);
+    EXPECT_TRUE(clipper.Execute(Clipper2Lib::ClipType::Difference,
+        Clipper2Lib::FillRule::NonZero, solution));
+    EXPECT_EQ(solution, expected);
+    EXPECT_EQ(Clipper2Lib::Difference(subjects, clips, Clipper2Lib::FillRule::NonZero), expected);
+}
+
+TEST(Clipper2Tests, TestCulledIntersection) {
+    //a large grid of squares clipped by a small 'viewport'
+    Clipper2Lib::Paths64 subjects;
+    for (int i = 0; i < 100; ++i)
+        for (int j = 0; j < 100; ++j)
+            subjects.push_back({
+                Clipper2Lib::Point64(i * 20, j * 20),
+                Clipper2Lib::Point64(i * 20 + 10, j * 20),
+                Clipper2Lib::Point64(i * 20 + 10, j * 20 + 10),
+                Clipper2Lib::Point64(i * 20, j * 20 + 10)
+            });
+    const Clipper2Lib::Paths64 clips = {{
+        Clipper2Lib::Point64(15, 15),
+        Clipper2Lib::Point64(65, 15),
+        Clipper2Lib::Point64(65, 65),
+        Clipper2Lib::Point64(15, 65)
+    }};
+
+    Clipper2Lib::Clipper64 clipper;
+    clipper.AddSubject(subjects);
+    clipper.AddClip(clips);
+    Clipper2Lib::Paths64 solution;
+    EXPECT_TRUE(clipper.Execute(Clipper2Lib::ClipType::Intersection,
+        Clipper2Lib::FillRule::NonZero, solution));
+    EXPECT_EQ(solution.size(), 9);
+    EXPECT_EQ(Clipper2Lib::Area(solution), 625);
+    EXPECT_EQ(Clipper2Lib::Intersect(subjects, clips, Clipper2Lib::FillRule::NonZero), solution);
+
+    //and the viewport minus the grid
+    Clipper2Lib::Clipper64 clipper2;
+    clipper2.AddSubject(clips);
+    clipper2.AddClip(subjects);
+    EXPECT_TRUE(clipper2.Execute(Clipper2Lib::ClipType::Difference,
+        Clipper2Lib::FillRule::NonZero, solution));
+    EXPECT_EQ(Clipper2Lib::Area(solution), 2500 - 625);
+    EXPECT_EQ(Clipper2Lib::Difference(clips, subjects, Clipper2Lib::FillRule::NonZero), solution);
+}
+
+TEST(Clipper2Tests, TestPreparedPaths) {
+    //a grid of jagged squares that's prepared once then clipped many times
+    std::srand(1);
+    Clipper2Lib::Paths64 subjects;
+    for (int i = 0; i < 40; ++i)
+        for (int j = 0; j < 40; ++j)
+        {
+            Clipper2Lib::Path64 path;
+            const int64_t x = i * 25, y = j * 25;
+            for (int k = 0; k < 5; ++k)
+                path.push_back(Clipper2Lib::Point64(x + k * 4, y + std::rand() % 5));
+            for (int k = 0; k < 5; ++k)
+                path.push_back(Clipper2Lib::Point64(x + 20 - std::rand() % 5, y + k * 4));
+            for (int k = 0; k < 5; ++k)
+                path.push_back(Clipper2Lib::Point64(x + 20 - k * 4, y + 20 - std::rand() % 5));
+            for (int k = 0; k < 5; ++k)
+                path.push_back(Clipper2Lib::Point64(x + std::rand() % 5, y + 20 - k * 4));
+            subjects.push_back(path);
+        }
+    const auto prepared = std::make_shared<const Clipper2Lib::PreparedPaths64>(subjects);
+    EXPECT_EQ(prepared->PathCount(), subjects.size());
+
+    std::vector<Clipper2Lib::Paths64> clips;
+    for (int i = 0; i < 16; ++i)
+    {
+        const int64_t x = std::rand() % 900, y = std::rand() % 900;
+        clips.push_back({{
+            Clipper2Lib::Point64(x, y),
+            Clipper2Lib::Point64(x + 150, y + 20),
+            Clipper2Lib::Point64(x + 100, y + 130)
+        }});
+    }
+
+    //clip concurrently (the same prepared paths in every thread), adding the
+    //prepared paths both before and after the clips
+    std::vector<Clipper2Lib::Paths64> intersections(clips.size()), differences(clips.size());
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < 4; ++t)
+        threads.emplace_back([&, t]()
+        {
+            for (size_t i = t; i < clips.size(); i += 4)
+            {
+                Clipper2Lib::Clipper64 clipper;
+                clipper.AddPrepared(prepared);
+                clipper.AddClip(clips[i]);
+                clipper.Execute(Clipper2Lib::ClipType::Intersection,
+                    Clipper2Lib::FillRule::NonZero, intersections[i]);
+                Clipper2Lib::Clipper64 clipper2;
+                clipper2.AddClip(clips[i]);
+                clipper2.AddPrepared(prepared);
+                clipper2.Execute(Clipper2Lib::ClipType::Difference,
+                    Clipper2Lib::FillRule::NonZero, differences[i]);
+            }
+        });
+    for (std::thread& thread : threads) thread.join();
+
+    for (size_t i = 0; i < clips.size(); ++i)
+    {
+        const Clipper2Lib::Paths64 expected =
+            Clipper2Lib::Intersect(subjects, clips[i], Clipper2Lib::FillRule::NonZero);
+        EXPECT_EQ(intersections[i].size(), expected.size());
+        EXPECT_EQ(Clipper2Lib::Area(intersections[i]), Clipper2Lib::Area(expected));
+        const Clipper2Lib::Paths64 expected2 =
+            Clipper2Lib::Difference(subjects, clips[i], Clipper2Lib::FillRule::NonZero);
+        EXPECT_EQ(differences[i].size(), expected2.size());
+        EXPECT_EQ(Clipper2Lib::Area(differences[i]), Clipper2Lib::Area(expected2));
+    }
+
+    //only one PreparedPaths64 can be added
+    Clipper2Lib::Clipper64 clipper;
+    clipper.AddPrepared(prepared);
+    EXPECT_THROW(clipper.AddPrepared(prepared), std::logic_error);
+    clipper.Clear();
+    clipper.AddPrepared(prepared);
+}
@@ -0,0 +1,260 @@
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include "../../Clipper2Lib/clipper.h"
+
+using namespace Clipper2Lib;
+
+static Path64 MakeSquare(int64_t left, int64_t top, int64_t size)
+{
+  return Path64{ Point64(left, top), Point64(left + size, top),
+    Point64(left + size, top + size), Point64(left, top + size) };
+}
+
+TEST(Clipper2Tests, TestOffsetGroups) {
+  //a grid of 20 x 20 squares, each 100 wide and 50 apart, with every square
+  //added as a separate group
+  const double delta = 10;
+  std::vector<Path64> squares;
+  for (int i = 0; i < 20; ++i)
+    for (int j = 0; j < 20; ++j)
+      squares.push_back(MakeSquare(i * 150, j * 150, 100));
+
+  Paths64 expected;
+  for (bool merge_groups : { false, true })
+    for (unsigned thread_cnt : { 1u, 4u })
+    {
+      ClipperOffset co;
+      co.MergeGroups(merge_groups);
+      co.ThreadCount(thread_cnt);
+      for (const Path64& square : squares)
+        co.AddPath(square, JoinType::Round, EndType::Polygon);
+      const Paths64 solution = co.Execute(delta);
+      //every group is offset (and the offsets don't overlap)
+      ASSERT_EQ(solution.size(), squares.size());
+      if (expected.empty()) expected = solution;
+      EXPECT_NEAR(Area(solution), Area(expected), 1.0);
+      if (!merge_groups)
+      {
+        EXPECT_EQ(solution, expected);
+      }
+    }
+  const double square_area = 120.0 * 120.0 - (20.0 * 20.0 - PI * 10.0 * 10.0);
+  EXPECT_NEAR(std::abs(Area(expected)), squares.size() * square_area,
+    squares.size() * 50.0);
+
+  //when MergeGroups is enabled, overlapping groups are merged
+  ClipperOffset co;
+  co.ThreadCount(4);
+  co.AddPath(MakeSquare(0, 0, 100), JoinType::Miter, EndType::Polygon);
+  co.AddPath(MakeSquare(110, 0, 100), JoinType::Miter, EndType::Polygon);
+  Paths64 solution = co.Execute(10);
+  ASSERT_EQ(solution.size(), 1);
+  EXPECT_EQ(std::abs(Area(solution)), 230 * 120);
+  co.MergeGroups(false);
+  solution = co.Execute(10);
+  EXPECT_EQ(solution.size(), 2);
+}
+
+TEST(Clipper2Tests, TestOffsetMultipleDeltas) {
+  std::srand(1);
+  Paths64 polygons, lines;
+  for (int i = 0; i < 20; ++i)
+  {
+    Path64 path;
+    const int64_t x = std::rand() % 1000, y = std::rand() % 1000;
+    for (int j = 0; j < 8; ++j)
+      path.push_back(Point64(x + std::rand() % 200, y + std::rand() % 200));
+    if (i % 2) polygons.push_back(path);
+    else lines.push_back(path);
+  }
+  const std::vector<double> deltas = { -8, -2, 0, 1.5, 5, 12, 20 };
+
+  //every solution should match Execute's solution for that delta
+  for (unsigned thread_cnt : { 1u, 4u })
+  {
+    ClipperOffset co;
+    co.ThreadCount(thread_cnt);
+    co.AddPaths(polygons, JoinType::Round, EndType::Polygon);
+    co.AddPaths(lines, JoinType::Miter, EndType::Joined);
+    co.AddPaths(lines, JoinType::Square, EndType::Round);
+    const std::vector<Paths64> solutions = co.Execute(deltas);
+    ASSERT_EQ(solutions.size(), deltas.size());
+    for (size_t i = 0; i < deltas.size(); ++i)
+    {
+      ClipperOffset co2;
+      co2.AddPaths(polygons, JoinType::Round, EndType::Polygon);
+      co2.AddPaths(lines, JoinType::Miter, EndType::Joined);
+      co2.AddPaths(lines, JoinType::Square, EndType::Round);
+      EXPECT_EQ(solutions[i], co2.Execute(deltas[i]));
+      //and paths are only prepared once, so repeated calls are cheaper
+      EXPECT_EQ(solutions[i], co.Execute(deltas[i]));
+    }
+  }
+}
+
+TEST(Clipper2Tests, TestInsetPaths) {
+  //a 1000 x 1000 square with a 100 x 100 hole, inset by 100 at each level
+  const Paths64 paths = { MakeSquare(0, 0, 1000),
+    MakePath("450,450, 450,550, 550,550, 550,450") };
+  Paths64 expected = paths;
+  std::vector<double> areas;
+  size_t level_cnt = InsetPaths(paths, 100, JoinType::Miter,
+    [&](size_t level, const Paths64& level_paths)
+    {
+      //each level should match InflatePaths applied to the previous level
+      expected = InflatePaths(expected, -100, JoinType::Miter, EndType::Polygon);
+      EXPECT_EQ(level, areas.size() + 1);
+      EXPECT_EQ(level_paths, expected);
+      areas.push_back(std::abs(Area(level_paths)));
+      return true;
+    });
+  //the outer square shrinks (to 800 then 600 wide) while the hole expands (to
+  //300 then 500 wide) until they meet at level 3
+  ASSERT_EQ(level_cnt, 2);
+  EXPECT_EQ(areas[0], 800 * 800 - 300 * 300);
+  EXPECT_EQ(areas[1], 600 * 600 - 500 * 500);
+  EXPECT_TRUE(InflatePaths(expected, -100, JoinType::Miter, EndType::Polygon).empty());
+
+  //without the hole, the 200 wide square at level 4 is the last level
+  level_cnt = InsetPaths(Paths64{ paths[0] }, 100, JoinType::Miter,
+    [](size_t, const Paths64& level_paths) { return !level_paths.empty(); });
+  EXPECT_EQ(level_cnt, 4);
+
+  //the callback can stop insetting early, as can max_levels
+  level_cnt = InsetPaths(paths, 100, JoinType::Round,
+    [](size_t level, const Paths64&) { return level < 2; });
+  EXPECT_EQ(level_cnt, 2);
+  level_cnt = InsetPaths(paths, 50, JoinType::Round,
+    [](size_t, const Paths64&) { return true; }, 2.0, 5);
+  EXPECT_EQ(level_cnt, 5);
+}
+
+TEST(Clipper2Tests, TestOffsetConvexPaths) {
+  //convex 'pads' (octagons 40 wide and 100 apart) each in a separate group.
+  //Their outward offsets can't self-intersect, so the cleanup union is skipped
+  //unless their bounds overlap
+  Paths64 pads, notched_pads;
+  for (int i = 0; i < 10; ++i)
+    for (int j = 0; j < 10; ++j)
+    {
+      const int64_t x = i * 100, y = j * 100;
+      Path64 pad = MakePath("10,0, 30,0, 40,10, 40,30, 30,40, 10,40, 0,30, 0,10");
+      pad = OffsetPath(pad, x, y);
+      pads.push_back(pad);
+      pad.insert(pad.begin() + 1, Point64(x + 20, y + 2));  //now concave
+      notched_pads.push_back(pad);
+    }
+
+  for (bool merge_groups : { true, false })
+  {
+    ClipperOffset co, co2;
+    co.MergeGroups(merge_groups);
+    co2.MergeGroups(merge_groups);
+    for (size_t i = 0; i < pads.size(); ++i)
+    {
+      co.AddPath(pads[i], JoinType::Round, EndType::Polygon);
+      co2.AddPath(notched_pads[i], JoinType::Round, EndType::Polygon);
+    }
+    Paths64 solution = co.Execute(10);
+    const Paths64 notched_solution = co2.Execute(10);
+    //the solution should match what the cleanup union would return
+    const Paths64 unioned = Union(solution, FillRule::NonZero);
+    ASSERT_EQ(solution.size(), pads.size());
+    EXPECT_EQ(unioned.size(), pads.size());
+    EXPECT_NEAR(std::abs(Area(solution)), std::abs(Area(unioned)), 1.0);
+    EXPECT_EQ(Area(solution) > 0, Area(notched_solution) > 0);
+    for (const Path64& path : solution)
+      EXPECT_EQ(StripDuplicates(path, true).size(), path.size());
+
+    //once offsets overlap, they're merged (or cleaned up) as usual. (When
+    //merged, there's one outer path with 9 x 9 holes)
+    solution = co.Execute(35);
+    EXPECT_EQ(solution.size(), merge_groups ? 82 : pads.size());
+  }
+
+  //when the cleanup union is skipped, collinear vertices and spikes (which
+  //rounding can create with small deltas) are still removed
+  ClipperOffset co;
+  co.MergeGroups(false);
+  co.AddPath(MakePath("0,0, 50,0, 100,0, 100,100, 0,100"),
+    JoinType::Miter, EndType::Polygon);
+  Paths64 solution = co.Execute(10);
+  ASSERT_EQ(solution.size(), 1);
+  EXPECT_EQ(solution[0].size(), 4);
+
+  Paths64 small_pads;
+  for (const char* pad : { "0,0, 3,1, 1,4", "0,0, 9,2, 7,5, 1,3",
+    "2,9, 9,5, 4,8", "0,0, 12,1, 20,6, 5,4" })
+    small_pads.push_back(OffsetPath(MakePath(pad),
+      static_cast<int64_t>(small_pads.size()) * 100, 0));
+  for (JoinType jt : { JoinType::Round, JoinType::Square, JoinType::Miter })
+    for (double delta = 0.5; delta < 3; delta += 0.05)
+    {
+      co.Clear();
+      for (const Path64& pad : small_pads)
+        co.AddPath(pad, jt, EndType::Polygon);
+      solution = co.Execute(delta);
+      const Paths64 unioned = Union(solution, FillRule::NonZero);
+      ASSERT_EQ(solution.size(), unioned.size());
+      size_t vertex_cnt = 0, unioned_vertex_cnt = 0;
+      for (const Path64& path : solution)
+      {
+        vertex_cnt += path.size();
+        for (size_t i = 0, j = path.size() - 1; i < path.size(); j = i++)
+          EXPECT_NE(CrossProduct(path[j], path[i], path[(i + 1) % path.size()]), 0);
+      }
+      for (const Path64& path : unioned) unioned_vertex_cnt += path.size();
+      EXPECT_EQ(vertex_cnt, unioned_vertex_cnt);
+    }
+}
+
+TEST(Clipper2Tests, TestOffsetRoundJoins) {
+  //round joins and caps should be within arc tolerance of true arcs. (Open
+  //paths are offset by delta / 2 on each side.)
+  const double delta = 100, arc_tolerance = 0.5;
+  ClipperOffset co(2.0, arc_tolerance);
+  co.MergeGroups(false);
+  co.AddPath(MakeSquare(0, 0, 1000), JoinType::Round, EndType::Polygon);
+  co.AddPath(MakePath("3000,0, 3000,1000"), JoinType::Round, EndType::Round);
+  co.AddPath(MakePath("5000,500"), JoinType::Round, EndType::Round);
+  const Paths64 solution = co.Execute(delta);
+  ASSERT_EQ(solution.size(), 3);
+
+  //vertices that aren't beside the square's edges or the line are on arcs
+  for (const Path64& path : solution)
+    for (const Point64& pt : path)
+    {
+      if (pt.x >= 2000 && pt.x <= 4000)
+      {
+        if (pt.y <= 0 || pt.y >= 1000)
+        {
+          EXPECT_NEAR(Distance(pt, Point64(3000, pt.y <= 0 ? 0 : 1000)), delta / 2, 1.0);
+        }
+      }
+      else if (pt.x > 4000)
+      {
+        EXPECT_NEAR(Distance(pt, Point64(5000, 500)), delta / 2, 1.0);
+      }
+      else if ((pt.x <= 0 || pt.x >= 1000) && (pt.y <= 0 || pt.y >= 1000))
+      {
+        EXPECT_NEAR(Distance(pt, Point64(pt.x <= 0 ? 0 : 1000,
+          pt.y <= 0 ? 0 : 1000)), delta, 1.0);
+      }
+    }
+
+  //and since arcs are approximated by chords, areas are slightly smaller
+  const double circle_area = PI * delta * delta;
+  const double square_area = 1200 * 1200 - 4 * delta * delta + circle_area;
+  EXPECT_LT(std::abs(Area(solution[0])), square_area);
+  EXPECT_GT(std::abs(Area(solution[0])), square_area - 2 * PI * delta * arc_tolerance);
+  EXPECT_LT(std::abs(Area(solution[2])), circle_area / 4);
+  EXPECT_GT(std::abs(Area(solution[2])), circle_area / 4 - PI * delta * arc_tolerance);
+
+  //arc tolerances larger than 2 * delta reduce round joins to bevels
+  ClipperOffset co2(2.0, 50.0);
+  co2.AddPath(MakePath("0,0, 100,0, 100,100, 0,100"), JoinType::Round, EndType::Polygon);
+  const Paths64 solution2 = co2.Execute(10);
+  ASSERT_EQ(solution2.size(), 1);
+  EXPECT_EQ(solution2[0].size(), 8);
+  EXPECT_EQ(std::abs(Area(solution2)), 14200);
+}
@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+#include "../../Clipper2Lib/clipper.h"
+
+using namespace Clipper2Lib;
+
+static Path64 MakeComb(int64_t left, int64_t top, int tooth_cnt)
+{
+  //a 'comb' with teeth pointing up, each 10 wide, 100 long and 10 apart
+  Path64 result;
+  result.push_back(Point64(left, top + 200));
+  for (int i = 0; i < tooth_cnt; ++i)
+  {
+    const int64_t x = left + i * 20;
+    result.push_back(Point64(x, top));
+    result.push_back(Point64(x + 10, top));
+    result.push_back(Point64(x + 10, top + 100));
+    result.push_back(Point64(x + 20, top + 100));
+  }
+  result.back().x -= 10;
+  result.push_back(Point64(result.back().x, top + 200));
+  return result;
+}
+
+TEST(Clipper2Tests, TestRectClip) {
+  const Rect64 rect(100, 100, 300, 300);
+  const Paths64 rect_paths = { MakePath("100,100, 300,100, 300,300, 100,300") };
+
+  Paths64 subjects = { MakePath("50,50, 150,50, 150,150, 50,150") };
+  Paths64 solution = RectClip(rect, subjects);
+  ASSERT_EQ(solution.size(), 1);
+  EXPECT_EQ(Area(solution), 2500);
+
+  //paths that are inside the rectangle are unchanged
+  subjects = { MakePath("110,110, 150,110, 150,150") };
+  EXPECT_EQ(RectClip(rect, subjects), subjects);
+
+  //paths that are outside the rectangle are removed
+  subjects = { MakePath("0,0, 400,0, 400,400, 350,400, 350,50, 0,50") };
+  EXPECT_EQ(RectClip(rect, subjects).size(), 0);
+
+  //paths that enclose the rectangle become the rectangle
+  subjects = { MakePath("0,200, 200,0, 400,200, 200,400") };
+  solution = RectClip(rect, subjects);
+  ASSERT_EQ(solution.size(), 1);
+  EXPECT_EQ(solution[0].size(), 4);
+  EXPECT_EQ(Area(solution), Area(rect_paths));
+
+  //paths that leave and re-enter the rectangle are split
+  subjects = { MakeComb(105, 20, 9) };
+  solution = RectClip(rect, subjects);
+  const Paths64 expected = Intersect(subjects, rect_paths, FillRule::NonZero);
+  EXPECT_EQ(solution.size(), expected.size());
+  EXPECT_EQ(Area(solution), Area(expected));
+
+  //and path orientation is preserved
+  std::reverse(subjects[0].begin(), subjects[0].end());
+  solution = RectClip(rect, subjects);
+  EXPECT_EQ(solution.size(), expected.size());
+  EXPECT_EQ(Area(solution), -Area(expected));
+
+  //paths with no area (eg bow-ties) may still have non-zero winding numbers
+  subjects = { MakePath("50,150, 350,250, 350,150, 50,250") };
+  solution = RectClip(rect, subjects);
+  ASSERT_EQ(solution.size(), 1);
+  EXPECT_EQ(Area(solution), 0);
+  EXPECT_EQ(Area(Union(solution, FillRule::NonZero)),
+    Area(Intersect(subjects, rect_paths, FillRule::NonZero)));
+}
+
+TEST(Clipper2Tests, TestRectClipManySplits) {
+  //a comb whose teeth each re-enter the rectangle (and so each become a
+  //separate path), which is slow if paths are split one piece at a time
+  const int tooth_cnt = 10000;
+  const Rect64 rect(-10, 50, tooth_cnt * 20, 150);
+  const Paths64 rect_paths = { MakePath("-10,50, 200000,50, 200000,150, -10,150") };
+  const Paths64 subjects = { MakeComb(0, 100, tooth_cnt) };
+  const Paths64 solution = RectClip(rect, subjects);
+  const Paths64 expected = Intersect(subjects, rect_paths, FillRule::NonZero);
+  EXPECT_EQ(solution.size(), tooth_cnt);
+  EXPECT_EQ(solution.size(), expected.size());
+  EXPECT_EQ(Area(solution), Area(expected));
+}
+
+TEST(Clipper2Tests, TestRectClipRandom) {
+  //RectClip should match Intersect for simple (not self-intersecting)
+  //polygons, here random star-shaped polygons
+  std::srand(1);
+  const Rect64 rect(20000, 20000, 80000, 60000);
+  const Paths64 rect_paths = { MakePath("20000,20000, 80000,20000, 80000,60000, 20000,60000") };
+  for (int i = 0; i < 100; ++i)
+  {
+    Path64 path;
+    const double cx = std::rand() % 1000 * 100, cy = std::rand() % 800 * 100;
+    for (int j = 0; j < 20; ++j)
+    {
+      const double angle = j * PI / 10, radius = (50 + std::rand() % 400) * 100;
+      path.push_back(Point64(static_cast<int64_t>(cx + radius * std::cos(angle)),
+        static_cast<int64_t>(cy + radius * std::sin(angle))));
+    }
+    const Paths64 solution = RectClip(rect, Paths64{ path });
+    const Paths64 expected = Intersect(Paths64{ path }, rect_paths, FillRule::NonZero);
+    EXPECT_NEAR(Area(solution), Area(expected), 1.0);
+  }
+}
+
+static double GetLength(const Paths64& paths)
+{
+  double result = 0;
+  for (const Path64& path : paths)
+    for (size_t i = 1; i < path.size(); ++i)
+      result += Distance(path[i - 1], path[i]);
+  return result;
+}
+
+TEST(Clipper2Tests, TestRectClipLines) {
+  const Rect64 rect(100, 100, 300, 300);
+  Paths64 lines = { MakePath("0,150, 400,150, 400,250, 0,250") };
+  Paths64 solution = RectClipLines(rect, lines);
+  ASSERT_EQ(solution.size(), 2);
+  EXPECT_EQ(solution[0], MakePath("100,150, 300,150"));
+  EXPECT_EQ(solution[1], MakePath("300,250, 100,250"));
+
+  //lines inside the rectangle are unchanged, and those outside are removed
+  lines = { MakePath("150,150, 250,250, 150,250"), MakePath("0,0, 400,0, 400,400") };
+  solution = RectClipLines(rect, lines);
+  ASSERT_EQ(solution.size(), 1);
+  EXPECT_EQ(solution[0], lines[0]);
+
+  //random lines should match Clipper64's clipping of open paths
+  std::srand(1);
+  const Paths64 rect_paths = { MakePath("10000,10000, 30000,10000, 30000,30000, 10000,30000") };
+  lines.clear();
+  for (int i = 0; i < 100; ++i)
+  {
+    Path64 line;
+    for (int j = 0; j < 10; ++j)
+      line.push_back(Point64(std::rand() % 400 * 100, std::rand() % 400 * 100));
+    lines.push_back(line);
+  }
+  solution = RectClipLines(Rect64(10000, 10000, 30000, 30000), lines);
+  Clipper64 clipper;
+  clipper.AddOpenSubject(lines);
+  clipper.AddClip(rect_paths);
+  Paths64 closed_paths, open_paths;
+  clipper.Execute(ClipType::Intersection, FillRule::NonZero, closed_paths, open_paths);
+  EXPECT_NEAR(GetLength(solution), GetLength(open_paths), 1.0);
+}
+
+TEST(Clipper2Tests, TestRectClipTiles) {
+  //random polygons and lines, some of which extend beyond the grid
+  std::srand(1);
+  Paths64 subjects, lines;
+  for (int i = 0; i < 200; ++i)
+  {
+    Path64 path;
+    const int64_t x = std::rand() % 1200 - 100, y = std::rand() % 900 - 100;
+    for (int j = 0; j < 6; ++j)
+      path.push_back(Point64(x + std::rand() % 200, y + std::rand() % 200));
+    subjects.push_back(path);
+    lines.push_back(path);
+  }
+
+  //every tile's solution should match RectClip's for that tile
+  const TileGrid grid(Point64(-50, -20), 100, 80, 9, 11);
+  for (unsigned thread_cnt : { 1u, 4u })
+  {
+    const std::vector<Paths64> tiles = RectClipTiles(grid, subjects, thread_cnt);
+    const std::vector<Paths64> line_tiles = RectClipLinesTiles(grid, lines, thread_cnt);
+    ASSERT_EQ(tiles.size(), grid.TileCount());
+    ASSERT_EQ(line_tiles.size(), grid.TileCount());
+    for (size_t row = 0; row < grid.rows; ++row)
+      for (size_t col = 0; col < grid.cols; ++col)
+      {
+        const Rect64 tile = grid.GetTile(row, col);
+        EXPECT_EQ(tiles[row * grid.cols + col], RectClip(tile, subjects));
+        EXPECT_EQ(line_tiles[row * grid.cols + col], RectClipLines(tile, lines));
+      }
+  }
+}
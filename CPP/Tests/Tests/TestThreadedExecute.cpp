@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include "../../Clipper2Lib/clipper.h"
+
+using namespace Clipper2Lib;
+
+static Paths64 MakeRandomPaths(int width, int height,
+  unsigned path_cnt, unsigned vertex_cnt)
+{
+  //small random polygons scattered over a large area
+  Paths64 result;
+  result.reserve(path_cnt);
+  for (unsigned i = 0; i < path_cnt; ++i)
+  {
+    const int64_t x = std::rand() % width * 100, y = std::rand() % height * 100;
+    Path64 path;
+    path.reserve(vertex_cnt);
+    for (unsigned j = 0; j < vertex_cnt; ++j)
+      path.push_back(Point64(x + std::rand() % 10000, y + std::rand() % 10000));
+    result.push_back(path);
+  }
+  return result;
+}
+
+static double GetSolutionArea(ClipType ct, FillRule fr,
+  const Paths64& subjects, const Paths64& clips, unsigned thread_cnt)
+{
+  Clipper64 clipper;
+  clipper.ThreadCount = thread_cnt;
+  clipper.AddSubject(subjects);
+  clipper.AddClip(clips);
+  Paths64 solution;
+  EXPECT_TRUE(clipper.Execute(ct, fr, solution));
+  return Area(solution);
+}
+
+TEST(Clipper2Tests, TestThreadedExecute) {
+  std::srand(1);
+  const Paths64 subjects = MakeRandomPaths(5000, 5000, 2500, 8);
+  const Paths64 clips = MakeRandomPaths(5000, 5000, 2500, 8);
+
+  for (ClipType ct : { ClipType::Intersection, ClipType::Union,
+    ClipType::Difference, ClipType::Xor })
+  {
+    const double serial_area = GetSolutionArea(ct, FillRule::NonZero, subjects, clips, 1);
+    const double banded_area = GetSolutionArea(ct, FillRule::NonZero, subjects, clips, 4);
+    //band boundaries add a few (rounded) vertices to the solution
+    EXPECT_NEAR(banded_area, serial_area, std::abs(serial_area) * 1e-5);
+  }
+}
+
+TEST(Clipper2Tests, TestBooleanOpBatch) {
+  std::srand(1);
+  const ClipType cliptypes[] = { ClipType::Intersection,
+    ClipType::Union, ClipType::Difference, ClipType::Xor };
+  std::vector<BooleanJob64> jobs(200);
+  for (size_t i = 0; i < jobs.size(); ++i)
+  {
+    jobs[i].cliptype = cliptypes[i % 4];
+    jobs[i].fillrule = (i % 3) ? FillRule::NonZero : FillRule::EvenOdd;
+    jobs[i].subjects = MakeRandomPaths(50, 50, 1 + i % 20, 6);
+    jobs[i].clips = MakeRandomPaths(50, 50, 1 + i % 7, 6);
+  }
+
+  //results should be in job order and match BooleanOp's solutions
+  for (unsigned thread_cnt : { 1u, 4u })
+  {
+    const std::vector<BooleanJobResult64> results = BooleanOpBatch(jobs, thread_cnt);
+    ASSERT_EQ(results.size(), jobs.size());
+    for (size_t i = 0; i < jobs.size(); ++i)
+    {
+      EXPECT_TRUE(results[i].succeeded);
+      EXPECT_GT(results[i].elapsed.count(), 0);
+      EXPECT_EQ(results[i].solution, BooleanOp(jobs[i].cliptype,
+        jobs[i].fillrule, jobs[i].subjects, jobs[i].clips));
+    }
+  }
+
+  //and likewise with PathsD
+  std::vector<BooleanJobD> jobs_d(1);
+  jobs_d[0].cliptype = ClipType::Union;
+  jobs_d[0].subjects = { MakePathD("0,0, 10,0, 10,10, 0,10") };
+  jobs_d[0].clips = { MakePathD("5,5, 15,5, 15,15, 5,15") };
+  const std::vector<BooleanJobResultD> results_d = BooleanOpBatch(jobs_d, 2);
+  ASSERT_EQ(results_d.size(), 1);
+  EXPECT_TRUE(results_d[0].succeeded);
+  EXPECT_DOUBLE_EQ(Area(results_d[0].solution), 175);
+}
+
+TEST(Clipper2Tests, TestExecuteAsync) {
+  std::srand(1);
+  Path64 path;  //a heavily self-intersecting polygon
+  for (int i = 0; i < 1000; ++i)
+    path.push_back(Point64(std::rand() % 100000, std::rand() % 100000));
+  const Paths64 subjects = { path };
+  const Paths64 expected = Union(subjects, FillRule::NonZero);
+
+  Clipper64 clipper;
+  clipper.AddSubject(subjects);
+  Paths64 solution;
+  std::future<bool> result = clipper.ExecuteAsync(ClipType::Union, FillRule::NonZero, solution);
+  EXPECT_TRUE(result.get());
+  EXPECT_EQ(clipper.Status(), ExecuteStatus::Success);
+  EXPECT_EQ(solution, expected);
+
+  //cancelled operations fail (and so do later ones until the token is replaced)
+  clipper.Cancellation.Cancel();
+  result = clipper.ExecuteAsync(ClipType::Union, FillRule::NonZero, solution);
+  EXPECT_FALSE(result.get());
+  EXPECT_EQ(clipper.Status(), ExecuteStatus::Cancelled);
+  EXPECT_TRUE(solution.empty());
+  EXPECT_FALSE(clipper.Execute(ClipType::Union, FillRule::NonZero, solution));
+  clipper.Cancellation = CancellationToken();
+  EXPECT_TRUE(clipper.Execute(ClipType::Union, FillRule::NonZero, solution));
+  EXPECT_EQ(solution, expected);
+
+  //as do overdue operations
+  clipper.Deadline = std::chrono::steady_clock::now();
+  EXPECT_FALSE(clipper.Execute(ClipType::Union, FillRule::NonZero, solution));
+  EXPECT_EQ(clipper.Status(), ExecuteStatus::TimedOut);
+
+  //including those clipped in bands
+  Clipper64 clipper2;
+  clipper2.ThreadCount = 4;
+  clipper2.AddSubject(MakeRandomPaths(5000, 5000, 10000, 8));
+  clipper2.Cancellation.Cancel();
+  EXPECT_FALSE(clipper2.Execute(ClipType::Union, FillRule::NonZero, solution));
+  EXPECT_EQ(clipper2.Status(), ExecuteStatus::Cancelled);
+
+  //ClipperD's asynchronous operations match its synchronous ones too
+  ClipperD clipperD(2);
+  clipperD.AddOpenSubject({ MakePathD("0,5, 20,5") });
+  clipperD.AddClip({ MakePathD("5,0, 10,0, 10,10, 5,10") });
+  PathsD expectedD, expected_openD, solutionD, solution_openD;
+  EXPECT_TRUE(clipperD.Execute(ClipType::Intersection, FillRule::NonZero,
+    expectedD, expected_openD));
+  EXPECT_TRUE(clipperD.ExecuteAsync(ClipType::Intersection, FillRule::NonZero,
+    solutionD, solution_openD).get());
+  EXPECT_EQ(solutionD, expectedD);
+  ASSERT_EQ(solution_openD.size(), 1);
+  EXPECT_EQ(solution_openD, expected_openD);
+}
+
+TEST(Clipper2Tests, TestReuseMemoryLimit) {
+  //reusing clippers retain their memory, but no more than ReuseMemoryLimit
+  const Path64 square = MakePath("0,0, 15,0, 15,15, 0,15");
+  Paths64 large;  //a grid of overlapping squares
+  for (int i = 0; i < 60; ++i)
+    for (int j = 0; j < 50; ++j)
+      large.push_back(OffsetPath(square, i * 10, j * 10));
+  const Paths64 small = { MakePath("0,0, 100,0, 100,100, 0,100") };
+  Clipper64 clipper;
+  clipper.ReuseMemory = true;
+  Paths64 solution;
+  for (size_t limit : { size_t(0), size_t(1) << 16 })
+  {
+    clipper.ReuseMemoryLimit = limit;
+    clipper.AddSubject(large);
+    EXPECT_TRUE(clipper.Execute(ClipType::Union, FillRule::NonZero, solution));
+    const size_t large_reserved = clipper.ArenaUsage().bytes_reserved;
+    EXPECT_GT(large_reserved, size_t(1) << 16);
+    clipper.Clear();
+    clipper.AddSubject(small);
+    EXPECT_TRUE(clipper.Execute(ClipType::Union, FillRule::NonZero, solution));
+    if (limit)
+    {
+      EXPECT_LE(clipper.ArenaUsage().bytes_reserved, limit);
+    }
+    else
+    {
+      EXPECT_EQ(clipper.ArenaUsage().bytes_reserved, large_reserved);
+    }
+    clipper.Clear();
+  }
+}
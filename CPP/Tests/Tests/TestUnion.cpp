@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <cstdlib>
 #include "../../Clipper2Lib/clipper.h"
 
 TEST(Clipper2Tests, TestBasicUnion) {
@@ -33,3 +34,98 @@ TEST(Clipper2Tests, TestBasicUnion) {
     ASSERT_EQ(solution.ChildCount(), 1);
     EXPECT_EQ(solution.childs.front()->polygon.size(), 8);
 }
+
+TEST(Clipper2Tests, TestUnionMany) {
+    //a large grid of overlapping rectangles with a few gaps
+    Clipper2Lib::Paths64 subjects;
+    for (int i = 0; i < 100; ++i)
+        for (int j = 0; j < 50; ++j)
+        {
+            if ((i * 7 + j * 3) % 11 == 0) continue;
+            const int64_t x = i * 10, y = j * 10;
+            subjects.push_back({
+                Clipper2Lib::Point64(x, y),
+                Clipper2Lib::Point64(x + 12, y),
+                Clipper2Lib::Point64(x + 12, y + 11),
+                Clipper2Lib::Point64(x, y + 11)
+            });
+        }
+
+    const Clipper2Lib::Paths64 expected =
+        Clipper2Lib::Union(subjects, Clipper2Lib::FillRule::NonZero);
+    for (unsigned thread_cnt : { 1u, 4u })
+    {
+        const Clipper2Lib::Paths64 solution = Clipper2Lib::UnionMany(
+            subjects, Clipper2Lib::FillRule::NonZero, thread_cnt);
+        EXPECT_EQ(solution.size(), expected.size());
+        EXPECT_EQ(Clipper2Lib::Area(solution), Clipper2Lib::Area(expected));
+    }
+
+    //with EvenOdd filling, regions where paths overlap (including paths in
+    //different groups) are removed
+    Clipper2Lib::Paths64 squares;
+    for (int i = 0; i < 20; ++i)
+        for (int j = 0; j < 10; ++j)
+        {
+            const int64_t x = i * 7, y = j * 7;
+            squares.push_back({
+                Clipper2Lib::Point64(x, y),
+                Clipper2Lib::Point64(x + 10, y),
+                Clipper2Lib::Point64(x + 10, y + 10),
+                Clipper2Lib::Point64(x, y + 10)
+            });
+        }
+    const Clipper2Lib::Paths64 expected_even_odd =
+        Clipper2Lib::Union(squares, Clipper2Lib::FillRule::EvenOdd);
+    for (unsigned thread_cnt : { 1u, 4u })
+    {
+        const Clipper2Lib::Paths64 solution = Clipper2Lib::UnionMany(
+            squares, Clipper2Lib::FillRule::EvenOdd, thread_cnt);
+        EXPECT_EQ(solution.size(), expected_even_odd.size());
+        EXPECT_EQ(Clipper2Lib::Area(solution), Clipper2Lib::Area(expected_even_odd));
+    }
+}
+
+TEST(Clipper2Tests, TestUnionOpenSubjects) {
+    //open subjects that cross closed subjects, where one end of an open path
+    //is terminated before its other end reaches the path's local maximum
+    const Clipper2Lib::Paths64 open_subjects = {
+        Clipper2Lib::MakePath("1,3, 19,25"),
+        Clipper2Lib::MakePath("8,7, 15,24, 8,23, 24,22, 10,18, 1,26, 4,7, 15,4, 4,18")
+    };
+    const Clipper2Lib::Paths64 subjects = {
+        Clipper2Lib::MakePath("23,15, 12,21, 6,26, 20,26, 21,4, 2,11, 3,13"),
+        Clipper2Lib::MakePath("2,2, 4,10, 7,23, 26,19")
+    };
+    Clipper2Lib::Clipper64 clipper;
+    clipper.AddOpenSubject(open_subjects);
+    clipper.AddSubject(subjects);
+    Clipper2Lib::Paths64 solution, solution_open;
+    clipper.Execute(Clipper2Lib::ClipType::Union,
+        Clipper2Lib::FillRule::NonZero, solution, solution_open);
+    EXPECT_EQ(Clipper2Lib::Area(solution),
+        Clipper2Lib::Area(Clipper2Lib::Union(subjects, Clipper2Lib::FillRule::NonZero)));
+    EXPECT_FALSE(solution_open.empty());
+
+    //and lots of random open and closed subjects
+    std::srand(1);
+    for (int i = 0; i < 500; ++i)
+    {
+        Clipper2Lib::Paths64 random_open, random_closed;
+        for (int j = 0; j < 4; ++j)
+        {
+            Clipper2Lib::Path64 path;
+            for (int k = 0; k < 8; ++k)
+                path.push_back(Clipper2Lib::Point64(std::rand() % 30, std::rand() % 30));
+            if (j < 2) random_closed.push_back(path);
+            random_open.push_back(path);
+        }
+        clipper.Clear();
+        clipper.AddOpenSubject(random_open);
+        clipper.AddSubject(random_closed);
+        clipper.Execute(Clipper2Lib::ClipType::Union,
+            Clipper2Lib::FillRule::NonZero, solution, solution_open);
+        for (const Clipper2Lib::Path64& path : solution_open)
+            EXPECT_GE(path.size(), 2);
+    }
+}
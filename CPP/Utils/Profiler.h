@@ -0,0 +1,216 @@
+#ifndef CLIPPER_PROFILER_H
+#define CLIPPER_PROFILER_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/*
+
+Profiler Usage:
+
+Like Timer objects, ProfileScope objects time the scope that contains them.
+But rather than sending each interval to standard output, the intervals of
+every named scope are accumulated so that, after many runs, each scope's
+count, total, min, mean, p99 and max times can be reported (as ProfileStats,
+or exported as CSV or JSON). Scopes can be nested, with each scope reported by
+its 'path' (eg "Execute/ExecuteInternal/ProcessJoinerList").
+
+Intervals are accumulated in thread-local storage, so profiling doesn't
+require any locking. A thread's intervals are added to the profiler's reports
+when the thread exits, or when it calls Profiler::Flush().
+
+When USINGPROFILER is defined (see clipper.core.h), the clipping engine's and
+ClipperOffset's main phases are also profiled.
+
+Example:
+
+  #include "Profiler.h"
+
+  void main()
+  {
+    for (int i = 0; i < 100; ++i)
+    {
+      ProfileScope scope("Union");
+      solution = Union(subject, clip, FillRule::NonZero);
+    }
+    std::cout << Profiler::ToCsv(Profiler::Report());
+  }
+
+*/
+
+namespace Clipper2Lib {
+
+  struct ProfileStats {
+    std::string name;   //the scope's path
+    size_t depth = 0;   //the number of enclosing scopes
+    size_t count = 0;
+    double total_ms = 0;
+    double min_ms = 0;
+    double mean_ms = 0;
+    double p99_ms = 0;
+    double max_ms = 0;
+  };
+
+  class Profiler {
+  private:
+    typedef std::map<std::string, std::vector<int64_t>> SampleMap;  //nanosecs
+
+    struct ThreadData {
+      std::string path;
+      std::vector<size_t> path_lengths;  //path's length before each scope
+      SampleMap samples;
+      ~ThreadData() { Merge(samples); }
+    };
+
+    static std::mutex& GetMutex()
+    {
+      static std::mutex mutex;
+      return mutex;
+    }
+
+    static SampleMap& GetSamples()
+    {
+      static SampleMap samples;
+      return samples;
+    }
+
+    static void Merge(SampleMap& samples)
+    {
+      std::lock_guard<std::mutex> lock(GetMutex());
+      SampleMap& all_samples = GetSamples();
+      for (auto& scope : samples)
+      {
+        std::vector<int64_t>& scope_samples = all_samples[scope.first];
+        scope_samples.insert(scope_samples.end(),
+          scope.second.begin(), scope.second.end());
+      }
+      samples.clear();
+    }
+
+    static std::string Escape(const std::string& s)
+    {
+      std::string result;
+      for (char c : s)
+      {
+        if (c == '"' || c == '\\') result += '\\';
+        result += c;
+      }
+      return result;
+    }
+
+    friend class ProfileScope;
+
+    static ThreadData& GetThreadData()
+    {
+      thread_local ThreadData data;
+      return data;
+    }
+
+  public:
+    //Flush: adds the calling thread's intervals to the profiler's reports
+    static void Flush() { Merge(GetThreadData().samples); }
+
+    //Reset: discards all intervals that have been flushed (and the calling
+    //thread's intervals)
+    static void Reset()
+    {
+      GetThreadData().samples.clear();
+      std::lock_guard<std::mutex> lock(GetMutex());
+      GetSamples().clear();
+    }
+
+    //Report: stats for every scope, with nested scopes following their parents
+    static std::vector<ProfileStats> Report()
+    {
+      Flush();
+      std::vector<ProfileStats> result;
+      std::lock_guard<std::mutex> lock(GetMutex());
+      for (const auto& scope : GetSamples())
+      {
+        if (scope.second.empty()) continue;
+        std::vector<int64_t> samples = scope.second;
+        std::sort(samples.begin(), samples.end());
+        ProfileStats stats;
+        stats.name = scope.first;
+        stats.depth = static_cast<size_t>(
+          std::count(scope.first.begin(), scope.first.end(), '/'));
+        stats.count = samples.size();
+        int64_t total = 0;
+        for (int64_t sample : samples) total += sample;
+        const size_t p99_idx = static_cast<size_t>(
+          std::ceil(0.99 * static_cast<double>(samples.size()))) - 1;
+        stats.total_ms = total * 1.0e-6;
+        stats.min_ms = samples.front() * 1.0e-6;
+        stats.mean_ms = stats.total_ms / static_cast<double>(samples.size());
+        stats.p99_ms = samples[p99_idx] * 1.0e-6;
+        stats.max_ms = samples.back() * 1.0e-6;
+        result.push_back(stats);
+      }
+      return result;
+    }
+
+    static std::string ToCsv(const std::vector<ProfileStats>& report)
+    {
+      std::ostringstream os;
+      os << "scope,depth,count,total_ms,min_ms,mean_ms,p99_ms,max_ms\n";
+      for (const ProfileStats& stats : report)
+        os << "\"" << Escape(stats.name) << "\"," << stats.depth << "," <<
+          stats.count << "," << stats.total_ms << "," << stats.min_ms << "," <<
+          stats.mean_ms << "," << stats.p99_ms << "," << stats.max_ms << "\n";
+      return os.str();
+    }
+
+    static std::string ToJson(const std::vector<ProfileStats>& report)
+    {
+      std::ostringstream os;
+      os << "[";
+      for (size_t i = 0; i < report.size(); ++i)
+      {
+        const ProfileStats& stats = report[i];
+        os << (i ? ",\n " : "\n ") << "{\"scope\": \"" << Escape(stats.name) <<
+          "\", \"depth\": " << stats.depth << ", \"count\": " << stats.count <<
+          ", \"total_ms\": " << stats.total_ms << ", \"min_ms\": " << stats.min_ms <<
+          ", \"mean_ms\": " << stats.mean_ms << ", \"p99_ms\": " << stats.p99_ms <<
+          ", \"max_ms\": " << stats.max_ms << "}";
+      }
+      os << "\n]\n";
+      return os.str();
+    }
+  };
+
+  class ProfileScope {
+  private:
+    Profiler::ThreadData& data_;
+    const std::chrono::steady_clock::time_point started_;
+  public:
+    explicit ProfileScope(const std::string& name) :
+      data_(Profiler::GetThreadData()), started_(std::chrono::steady_clock::now())
+    {
+      data_.path_lengths.push_back(data_.path.size());
+      if (!data_.path.empty()) data_.path += '/';
+      data_.path += name;
+    }
+
+    ~ProfileScope()
+    {
+      data_.samples[data_.path].push_back(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - started_).count());
+      data_.path.resize(data_.path_lengths.back());
+      data_.path_lengths.pop_back();
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+  };
+
+} //namespace
+
+#endif  //CLIPPER_PROFILER_H
@@ -5,6 +5,8 @@
 #include <string>
 #include <chrono> 
 #include <iomanip>
+#include <iostream>
+#include <cmath>
 
 /*
 
@@ -40,14 +42,14 @@ Example:
 struct Timer {
 private:
   std::streamsize old_precision;
-  int old_flags;
+  std::ios_base::fmtflags old_flags;
   std::chrono::steady_clock::time_point time_started = {};
   std::string _time_text = "";  
   void init() 
   { 
     old_precision = std::cout.precision(0);
     old_flags = std::cout.flags();
-    time_started = std::chrono::high_resolution_clock::now(); 
+    time_started = std::chrono::steady_clock::now(); 
   }
 public:
   explicit Timer() { init(); }  
@@ -61,7 +63,7 @@ public:
   ~Timer()
   {
     std::chrono::steady_clock::time_point 
-      time_ended = std::chrono::high_resolution_clock::now();
+      time_ended = std::chrono::steady_clock::now();
     int nsecs = static_cast<int>(std::log10(std::chrono::duration_cast<std::chrono::nanoseconds>
       (time_ended - time_started).count()));
 
@@ -81,4 +83,4 @@ public:
   }
 };
 
-#endif CLIPPER_TIMER_H
\ No newline at end of file
+#endif  //CLIPPER_TIMER_H
\ No newline at end of file